@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures time steps of an update over a whole grid followed by a stencil
+// over its interior, with a grid that fits in the combined L2 caches of the
+// threads. Static schedules split the two segments differently, so threads
+// read data last written by other cores, while the affinity policies run
+// every index on the same thread in both loops.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <type_traits>
+#include <vector>
+
+//
+// 2^18 entries per array, 2 MiB each
+//
+constexpr RAJA::Index_type grid_len = 1 << 18;
+
+//
+// Width of the boundary left out of the interior, large enough that static
+// schedules over the two segments differ by many cache lines per thread
+//
+constexpr RAJA::Index_type halo_len = grid_len / 8;
+
+template <typename ExecPolicy>
+static ExecPolicy make_policy(RAJA::affinity_schedule const& sched,
+                              std::true_type)
+{
+  return ExecPolicy(sched);
+}
+
+template <typename ExecPolicy>
+static ExecPolicy make_policy(RAJA::affinity_schedule const&, std::false_type)
+{
+  return ExecPolicy{};
+}
+
+template <typename ExecPolicy>
+static void benchmark_timestep(benchmark::State& state)
+{
+  std::vector<double> u(grid_len, 1.0), v(grid_len, 0.0);
+  double* pu = u.data();
+  double* pv = v.data();
+
+  RAJA::affinity_schedule sched;
+  const ExecPolicy pol = make_policy<ExecPolicy>(
+      sched,
+      std::is_constructible<ExecPolicy, RAJA::affinity_schedule>{});
+
+  const RAJA::RangeSegment grid(0, grid_len);
+  const RAJA::RangeSegment interior(halo_len, grid_len - halo_len);
+
+  while (state.KeepRunning()) {
+    RAJA::forall(pol, grid, [=](RAJA::Index_type i) {
+      pu[i] = 0.5 * pu[i] + 0.25 * pv[i];
+    });
+    RAJA::forall(pol, interior, [=](RAJA::Index_type i) {
+      pv[i] = pu[i - 1] - 2.0 * pu[i] + pu[i + 1];
+    });
+    benchmark::DoNotOptimize(pv[halo_len]);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          (2 * grid_len - 2 * halo_len));
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_timestep, RAJA::omp_parallel_for_static_exec<>);
+BENCHMARK_TEMPLATE(benchmark_timestep, RAJA::omp_parallel_for_affinity_exec);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_timestep, RAJA::tbb_for_static<>);
+BENCHMARK_TEMPLATE(benchmark_timestep, RAJA::tbb_for_dynamic);
+BENCHMARK_TEMPLATE(benchmark_timestep, RAJA::tbb_for_affinity);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,66 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures a histogram over a few bins, where every thread updates the same
+// locations, with RAJA::atomicAdd of an atomic policy and of
+// combining_atomic over that policy. The combining variants include the
+// flush at the end of every pass, so the times compare the whole update.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+//
+// 2^20 updates per pass into 8 bins
+//
+constexpr RAJA::Index_type num_updates = 1 << 20;
+constexpr int num_bins = 8;
+
+template <typename ExecPolicy, typename AtomicPolicy>
+static void benchmark_histogram(benchmark::State& state)
+{
+  std::vector<long> bins(num_bins, 0);
+  long* pbins = bins.data();
+
+  while (state.KeepRunning()) {
+    {
+      RAJA::combining_atomic_scope scope;
+      RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, num_updates),
+                               [=](RAJA::Index_type i) {
+                                 RAJA::atomicAdd<AtomicPolicy>(
+                                     &pbins[i % num_bins], 1L);
+                               });
+    }
+    benchmark::DoNotOptimize(pbins[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_updates);
+}
+
+BENCHMARK_TEMPLATE2(benchmark_histogram, RAJA::seq_exec, RAJA::builtin_atomic);
+BENCHMARK_TEMPLATE2(benchmark_histogram,
+                    RAJA::seq_exec,
+                    RAJA::combining_atomic<RAJA::builtin_atomic>);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE2(benchmark_histogram,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::builtin_atomic);
+BENCHMARK_TEMPLATE2(benchmark_histogram,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::combining_atomic<RAJA::builtin_atomic>);
+BENCHMARK_TEMPLATE2(benchmark_histogram,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_atomic);
+BENCHMARK_TEMPLATE2(benchmark_histogram,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::combining_atomic<RAJA::omp_atomic>);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures a chain of four daxpy updates over vectors larger than the last
+// level cache, run as one RAJA::forall per update, as one forall_fused
+// traversal, and as one forall_fused_chunked traversal with cache-sized
+// chunks. The separate loops stream the vectors through memory once per
+// update, and with OpenMP fork a parallel region per update.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+//
+// 2^23 entries per vector, 64 MiB each
+//
+constexpr RAJA::Index_type vector_len = 1 << 23;
+
+//
+// 2^12 entries per chunk, so the chunks of the five vectors fit in L2
+//
+constexpr RAJA::Index_type chunk_len = 1 << 12;
+
+struct DaxpyChain {
+  std::vector<double> x, y0, y1, y2, y3;
+
+  DaxpyChain()
+      : x(vector_len, 1.0),
+        y0(vector_len, 0.0),
+        y1(vector_len, 0.0),
+        y2(vector_len, 0.0),
+        y3(vector_len, 0.0)
+  {
+  }
+};
+
+template <typename ExecPolicy>
+static void benchmark_daxpy_chain_separate(benchmark::State& state)
+{
+  DaxpyChain v;
+  const double* x = v.x.data();
+  double* y0 = v.y0.data();
+  double* y1 = v.y1.data();
+  double* y2 = v.y2.data();
+  double* y3 = v.y3.data();
+
+  const RAJA::RangeSegment range(0, vector_len);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(range, [=](RAJA::Index_type i) {
+      y0[i] += 0.5 * x[i];
+    });
+    RAJA::forall<ExecPolicy>(range, [=](RAJA::Index_type i) {
+      y1[i] += 0.5 * y0[i];
+    });
+    RAJA::forall<ExecPolicy>(range, [=](RAJA::Index_type i) {
+      y2[i] += 0.5 * y1[i];
+    });
+    RAJA::forall<ExecPolicy>(range, [=](RAJA::Index_type i) {
+      y3[i] += 0.5 * y2[i];
+    });
+    benchmark::DoNotOptimize(y3[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * vector_len);
+}
+
+template <typename ExecPolicy>
+static void benchmark_daxpy_chain_fused(benchmark::State& state)
+{
+  DaxpyChain v;
+  const double* x = v.x.data();
+  double* y0 = v.y0.data();
+  double* y1 = v.y1.data();
+  double* y2 = v.y2.data();
+  double* y3 = v.y3.data();
+
+  const RAJA::RangeSegment range(0, vector_len);
+
+  while (state.KeepRunning()) {
+    RAJA::forall_fused<ExecPolicy>(
+        range,
+        [=](RAJA::Index_type i) { y0[i] += 0.5 * x[i]; },
+        [=](RAJA::Index_type i) { y1[i] += 0.5 * y0[i]; },
+        [=](RAJA::Index_type i) { y2[i] += 0.5 * y1[i]; },
+        [=](RAJA::Index_type i) { y3[i] += 0.5 * y2[i]; });
+    benchmark::DoNotOptimize(y3[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * vector_len);
+}
+
+template <typename ExecPolicy>
+static void benchmark_daxpy_chain_chunked(benchmark::State& state)
+{
+  DaxpyChain v;
+  const double* x = v.x.data();
+  double* y0 = v.y0.data();
+  double* y1 = v.y1.data();
+  double* y2 = v.y2.data();
+  double* y3 = v.y3.data();
+
+  const RAJA::RangeSegment range(0, vector_len);
+
+  while (state.KeepRunning()) {
+    RAJA::forall_fused_chunked<ExecPolicy>(
+        chunk_len,
+        range,
+        [=](RAJA::Index_type i) { y0[i] += 0.5 * x[i]; },
+        [=](RAJA::Index_type i) { y1[i] += 0.5 * y0[i]; },
+        [=](RAJA::Index_type i) { y2[i] += 0.5 * y1[i]; },
+        [=](RAJA::Index_type i) { y3[i] += 0.5 * y2[i]; });
+    benchmark::DoNotOptimize(y3[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * vector_len);
+}
+
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_separate, RAJA::seq_exec);
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_fused, RAJA::seq_exec);
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_chunked, RAJA::seq_exec);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_separate, RAJA::omp_parallel_for_exec);
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_fused, RAJA::omp_parallel_for_exec);
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_chunked, RAJA::omp_parallel_for_exec);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_separate, RAJA::tbb_for_exec);
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_fused, RAJA::tbb_for_exec);
+BENCHMARK_TEMPLATE(benchmark_daxpy_chain_chunked, RAJA::tbb_for_exec);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures the cost of launching small forall loops, which is dominated by
+// dispatch (plugin hooks, body capture, parallel region startup) rather
+// than by the loop itself. Compare against the raw loops, and against a
+// build with RAJA_ENABLE_PLUGINS=Off.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+static constexpr int MAX_N = 10000;
+
+template <int N>
+static void benchmark_launch_raw(benchmark::State& state)
+{
+  double* a = new double[MAX_N];
+  double* b = new double[MAX_N];
+
+  for (int i = 0; i < MAX_N; i++) {
+    a[i] = 1.0;
+    b[i] = 2.0;
+  }
+  double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < N; i++) {
+      a[i] += b[i] * c;
+    }
+    benchmark::DoNotOptimize(a);
+  }
+
+  delete[] a;
+  delete[] b;
+}
+
+template <typename ExecPolicy, int N>
+static void benchmark_launch_forall(benchmark::State& state)
+{
+  double* a = new double[MAX_N];
+  double* b = new double[MAX_N];
+
+  for (int i = 0; i < MAX_N; i++) {
+    a[i] = 1.0;
+    b[i] = 2.0;
+  }
+  double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N),
+                             [=](int i) { a[i] += b[i] * c; });
+    benchmark::DoNotOptimize(a);
+  }
+
+  delete[] a;
+  delete[] b;
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <int N>
+static void benchmark_launch_omp_raw(benchmark::State& state)
+{
+  double* a = new double[MAX_N];
+  double* b = new double[MAX_N];
+
+  for (int i = 0; i < MAX_N; i++) {
+    a[i] = 1.0;
+    b[i] = 2.0;
+  }
+  double c = 3.14159;
+
+  while (state.KeepRunning()) {
+#pragma omp parallel for
+    for (int i = 0; i < N; i++) {
+      a[i] += b[i] * c;
+    }
+    benchmark::DoNotOptimize(a);
+  }
+
+  delete[] a;
+  delete[] b;
+}
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_launch_raw, 0);
+BENCHMARK_TEMPLATE(benchmark_launch_raw, 16);
+BENCHMARK_TEMPLATE(benchmark_launch_raw, 10000);
+
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::seq_exec, 0);
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::seq_exec, 16);
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::seq_exec, 10000);
+
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::loop_exec, 0);
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::loop_exec, 16);
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::loop_exec, 10000);
+
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::simd_exec, 0);
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::simd_exec, 16);
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::simd_exec, 10000);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_launch_omp_raw, 0);
+BENCHMARK_TEMPLATE(benchmark_launch_omp_raw, 16);
+BENCHMARK_TEMPLATE(benchmark_launch_omp_raw, 10000);
+
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::omp_parallel_for_exec, 0);
+BENCHMARK_TEMPLATE2(benchmark_launch_forall, RAJA::omp_parallel_for_exec, 16);
+BENCHMARK_TEMPLATE2(benchmark_launch_forall,
+                    RAJA::omp_parallel_for_exec,
+                    10000);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures the throughput of Layout::toIndices for 3D to 5D layouts, which
+// divides by precomputed multiply-shift constants, against the same index
+// recovery with integer divide instructions. Sizes are odd and read at run
+// time, so the compiler cannot replace the divisions itself.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <array>
+
+//
+// About 2^21 indices in each layout
+//
+template <size_t N>
+struct LayoutSizes;
+
+template <>
+struct LayoutSizes<3> {
+  static std::array<RAJA::Index_type, 3> get() { return {{127, 129, 131}}; }
+};
+
+template <>
+struct LayoutSizes<4> {
+  static std::array<RAJA::Index_type, 4> get()
+  {
+    return {{37, 39, 41, 35}};
+  }
+};
+
+template <>
+struct LayoutSizes<5> {
+  static std::array<RAJA::Index_type, 5> get()
+  {
+    return {{17, 19, 21, 15, 13}};
+  }
+};
+
+template <size_t N>
+static RAJA::Layout<N> makeLayout()
+{
+  return RAJA::make_permuted_layout(
+      LayoutSizes<N>::get(), RAJA::as_array<RAJA::MakePerm<N>>::get());
+}
+
+//
+// Sum of the indices of each linear index, so no index is optimized out
+//
+template <size_t N, camp::idx_t... Dims>
+static RAJA::Index_type sumIndices(const RAJA::Layout<N>& layout,
+                                   camp::idx_seq<Dims...>)
+{
+  RAJA::Index_type total = 0;
+  const RAJA::Index_type len = layout.size();
+  for (RAJA::Index_type lin = 0; lin < len; ++lin) {
+    RAJA::Index_type idx[N];
+    layout.toIndices(lin, idx[Dims]...);
+    for (size_t d = 0; d < N; ++d) {
+      total += idx[d];
+    }
+  }
+  return total;
+}
+
+//
+// Same, with the divisions of the inverse map done by divide instructions
+//
+template <size_t N>
+static RAJA::Index_type sumIndicesDivide(const RAJA::Layout<N>& layout)
+{
+  RAJA::Index_type strides[N];
+  RAJA::Index_type sizes[N];
+  for (size_t d = 0; d < N; ++d) {
+    strides[d] = layout.inv_strides[d];
+    sizes[d] = layout.inv_mods[d];
+  }
+
+  RAJA::Index_type total = 0;
+  const RAJA::Index_type len = layout.size();
+  for (RAJA::Index_type lin = 0; lin < len; ++lin) {
+    RAJA::Index_type idx[N];
+    for (size_t d = 0; d < N; ++d) {
+      idx[d] = (lin / strides[d]) % sizes[d];
+    }
+    for (size_t d = 0; d < N; ++d) {
+      total += idx[d];
+    }
+  }
+  return total;
+}
+
+template <size_t N>
+static void benchmark_toindices_layout(benchmark::State& state)
+{
+  const RAJA::Layout<N> layout = makeLayout<N>();
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(sumIndices(layout, camp::make_idx_seq_t<N>{}));
+  }
+  state.SetItemsProcessed(state.iterations() * layout.size());
+}
+
+template <size_t N>
+static void benchmark_toindices_divide(benchmark::State& state)
+{
+  const RAJA::Layout<N> layout = makeLayout<N>();
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(sumIndicesDivide(layout));
+  }
+  state.SetItemsProcessed(state.iterations() * layout.size());
+}
+
+BENCHMARK_TEMPLATE(benchmark_toindices_layout, 3);
+BENCHMARK_TEMPLATE(benchmark_toindices_divide, 3);
+BENCHMARK_TEMPLATE(benchmark_toindices_layout, 4);
+BENCHMARK_TEMPLATE(benchmark_toindices_divide, 4);
+BENCHMARK_TEMPLATE(benchmark_toindices_layout, 5);
+BENCHMARK_TEMPLATE(benchmark_toindices_divide, 5);
+
+BENCHMARK_MAIN();
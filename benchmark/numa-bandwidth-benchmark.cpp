@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures the memory bandwidth of a STREAM triad run with
+// omp_parallel_for_static_exec, on arrays whose pages are placed by the
+// master thread (malloc followed by a serial initialization), by
+// RAJA::numa first touch with the same static partition as the loop, and
+// interleaved over all nodes. On a multi-socket node, master placement
+// pulls most of the data across the socket interconnect; run with
+// OMP_PROC_BIND=spread OMP_PLACES=cores so threads stay on their node.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdlib>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+static constexpr size_t TRIAD_N = 1 << 25;
+
+static void triad(double* a, double* b, double* c, benchmark::State& state)
+{
+  const double scalar = 3.0;
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+        RAJA::TypedRangeSegment<size_t>(0, TRIAD_N),
+        [=](size_t i) { a[i] = b[i] + scalar * c[i]; });
+    benchmark::DoNotOptimize(a);
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * TRIAD_N * sizeof(double));
+}
+
+static void benchmark_triad_master_touch(benchmark::State& state)
+{
+  double* a = static_cast<double*>(std::malloc(TRIAD_N * sizeof(double)));
+  double* b = static_cast<double*>(std::malloc(TRIAD_N * sizeof(double)));
+  double* c = static_cast<double*>(std::malloc(TRIAD_N * sizeof(double)));
+  for (size_t i = 0; i < TRIAD_N; ++i) {
+    a[i] = 0.0;
+    b[i] = 1.0;
+    c[i] = 2.0;
+  }
+
+  triad(a, b, c, state);
+
+  std::free(a);
+  std::free(b);
+  std::free(c);
+}
+
+template <RAJA::numa::placement Mode>
+static void benchmark_triad_numa(benchmark::State& state)
+{
+  double* a = RAJA::numa::allocate<double>(TRIAD_N, Mode);
+  double* b = RAJA::numa::allocate<double>(TRIAD_N, Mode);
+  double* c = RAJA::numa::allocate<double>(TRIAD_N, Mode);
+  RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+      RAJA::TypedRangeSegment<size_t>(0, TRIAD_N), [=](size_t i) {
+        b[i] = 1.0;
+        c[i] = 2.0;
+      });
+
+  triad(a, b, c, state);
+
+  RAJA::numa::deallocate(a);
+  RAJA::numa::deallocate(b);
+  RAJA::numa::deallocate(c);
+}
+
+BENCHMARK(benchmark_triad_master_touch)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_triad_numa, RAJA::numa::placement::first_touch)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_triad_numa, RAJA::numa::placement::interleave)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
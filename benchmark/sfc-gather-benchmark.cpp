@@ -0,0 +1,289 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures a zone-to-node gather on a hexahedral mesh whose nodes and zones
+// are numbered in random "file" order, and after renumbering both along a
+// Morton or Hilbert curve. The mesh is too large for cache, so the time is
+// dominated by cache misses in the gather. On Linux the last level cache
+// misses per gather are counted with perf_event and reported in the label
+// of each benchmark; where the counter cannot be opened, e.g. in a
+// container without perf_event access, the label says that time is the only
+// metric.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static constexpr RAJA::Index_type MESH_N = 96;
+
+//
+// Mesh of MESH_N^3 zones with 8 nodes each, numbered as read from a file
+//
+struct GatherMesh {
+  RAJA::Index_type num_nodes;
+  RAJA::Index_type num_zones;
+  std::vector<double> x, y, z;
+  std::vector<double> node_data;
+  std::vector<RAJA::Index_type> zone_nodes;
+
+  GatherMesh()
+  {
+    const RAJA::Index_type nn = MESH_N + 1;
+    num_nodes = nn * nn * nn;
+    num_zones = MESH_N * MESH_N * MESH_N;
+
+    std::mt19937 gen(1234);
+    std::vector<RAJA::Index_type> node_num(num_nodes);
+    std::vector<RAJA::Index_type> zone_num(num_zones);
+    for (RAJA::Index_type i = 0; i < num_nodes; ++i) node_num[i] = i;
+    for (RAJA::Index_type i = 0; i < num_zones; ++i) zone_num[i] = i;
+    std::shuffle(node_num.begin(), node_num.end(), gen);
+    std::shuffle(zone_num.begin(), zone_num.end(), gen);
+
+    x.resize(num_nodes);
+    y.resize(num_nodes);
+    z.resize(num_nodes);
+    node_data.resize(num_nodes);
+    for (RAJA::Index_type k = 0; k < nn; ++k) {
+      for (RAJA::Index_type j = 0; j < nn; ++j) {
+        for (RAJA::Index_type i = 0; i < nn; ++i) {
+          RAJA::Index_type n = node_num[(k * nn + j) * nn + i];
+          x[n] = i;
+          y[n] = j;
+          z[n] = k;
+          node_data[n] = 1.0;
+        }
+      }
+    }
+
+    zone_nodes.resize(8 * num_zones);
+    for (RAJA::Index_type k = 0; k < MESH_N; ++k) {
+      for (RAJA::Index_type j = 0; j < MESH_N; ++j) {
+        for (RAJA::Index_type i = 0; i < MESH_N; ++i) {
+          RAJA::Index_type zone = zone_num[(k * MESH_N + j) * MESH_N + i];
+          for (int c = 0; c < 8; ++c) {
+            RAJA::Index_type node =
+                ((k + (c >> 2)) * nn + j + ((c >> 1) & 1)) * nn + i + (c & 1);
+            zone_nodes[8 * zone + c] = node_num[node];
+          }
+        }
+      }
+    }
+  }
+
+  //
+  // Renumber nodes and zones along a curve through node positions and
+  // zone centers
+  //
+  template <typename Order>
+  void renumber()
+  {
+    std::vector<RAJA::Index_type> perm(num_nodes);
+    std::vector<RAJA::Index_type> inv(num_nodes);
+    RAJA::computeCurvePermutation<RAJA::seq_exec, Order>(
+        std::array<const double*, 3>{{x.data(), y.data(), z.data()}},
+        num_nodes,
+        perm.data());
+    RAJA::invertPermutation<RAJA::seq_exec>(perm.data(), num_nodes, inv.data());
+
+    std::vector<double> tmp(num_nodes);
+    for (std::vector<double>* a : {&x, &y, &z, &node_data}) {
+      RAJA::permuteArray<RAJA::seq_exec>(perm.data(), num_nodes, a->data(),
+                                         tmp.data());
+      a->swap(tmp);
+    }
+
+    std::vector<double> cx(num_zones, 0.0), cy(num_zones, 0.0),
+        cz(num_zones, 0.0);
+    for (RAJA::Index_type zone = 0; zone < num_zones; ++zone) {
+      for (int c = 0; c < 8; ++c) {
+        RAJA::Index_type& node = zone_nodes[8 * zone + c];
+        node = inv[node];
+        cx[zone] += x[node];
+        cy[zone] += y[node];
+        cz[zone] += z[node];
+      }
+    }
+
+    std::vector<RAJA::Index_type> zone_perm(num_zones);
+    RAJA::computeCurvePermutation<RAJA::seq_exec, Order>(
+        std::array<const double*, 3>{{cx.data(), cy.data(), cz.data()}},
+        num_zones,
+        zone_perm.data());
+    std::vector<RAJA::Index_type> new_zone_nodes(8 * num_zones);
+    for (RAJA::Index_type zone = 0; zone < num_zones; ++zone) {
+      std::copy_n(&zone_nodes[8 * zone_perm[zone]], 8,
+                  &new_zone_nodes[8 * zone]);
+    }
+    zone_nodes.swap(new_zone_nodes);
+  }
+};
+
+//
+// Last level cache misses of the threads of the process that exist when the
+// counter is made, counted in user space by Linux perf_event
+//
+class CacheMissCounter
+{
+public:
+  CacheMissCounter()
+  {
+#if defined(__linux__)
+    DIR* dir = opendir("/proc/self/task");
+    if (dir == nullptr) return;
+    while (dirent* entry = readdir(dir)) {
+      if (entry->d_name[0] == '.') continue;
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format =
+          PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      const long fd = syscall(
+          __NR_perf_event_open, &attr, std::atoi(entry->d_name), -1, -1, 0);
+      if (fd < 0) {
+        failed = true;
+        break;
+      }
+      fds.push_back(static_cast<int>(fd));
+    }
+    closedir(dir);
+#endif
+  }
+
+  ~CacheMissCounter()
+  {
+#if defined(__linux__)
+    for (int fd : fds) {
+      close(fd);
+    }
+#endif
+  }
+
+  //! False when some thread could not be counted
+  bool valid() const { return !failed && !fds.empty(); }
+
+  //! Misses counted so far, scaled up when the counter was multiplexed
+  double read() const
+  {
+    double misses = 0.0;
+#if defined(__linux__)
+    for (int fd : fds) {
+      // { value, time_enabled, time_running }
+      uint64_t buf[3];
+      if (::read(fd, buf, sizeof(buf)) == sizeof(buf) && buf[2] > 0) {
+        misses += static_cast<double>(buf[0]) * buf[1] / buf[2];
+      }
+    }
+#endif
+    return misses;
+  }
+
+private:
+  std::vector<int> fds;
+  bool failed = false;
+};
+
+template <typename ExecPolicy>
+static void gather(GatherMesh& mesh,
+                   std::vector<double>& zone_data,
+                   benchmark::State& state)
+{
+  const double* node_data = mesh.node_data.data();
+  const RAJA::Index_type* zone_nodes = mesh.zone_nodes.data();
+  double* zdata = zone_data.data();
+  const RAJA::Index_type num_zones = mesh.num_zones;
+
+  auto run = [=]() {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, num_zones),
+                             [=](RAJA::Index_type zone) {
+      double sum = 0.0;
+      for (int c = 0; c < 8; ++c) {
+        sum += node_data[zone_nodes[8 * zone + c]];
+      }
+      zdata[zone] = 0.125 * sum;
+    });
+  };
+
+  // one gather first, so the threads of the policy exist when the counter
+  // is made
+  run();
+  CacheMissCounter misses;
+
+  long num_gathers = 0;
+  while (state.KeepRunning()) {
+    run();
+    benchmark::DoNotOptimize(zdata);
+    ++num_gathers;
+  }
+
+  if (misses.valid() && num_gathers > 0) {
+    state.SetLabel("llc_misses/gather=" +
+                   std::to_string(static_cast<long>(misses.read() /
+                                                    num_gathers)));
+  } else {
+    state.SetLabel("time only, cache miss counter not available");
+  }
+}
+
+template <typename ExecPolicy>
+static void benchmark_gather_file_order(benchmark::State& state)
+{
+  GatherMesh mesh;
+  std::vector<double> zone_data(mesh.num_zones);
+
+  gather<ExecPolicy>(mesh, zone_data, state);
+}
+
+template <typename ExecPolicy, typename Order>
+static void benchmark_gather_curve_order(benchmark::State& state)
+{
+  GatherMesh mesh;
+  mesh.renumber<Order>();
+  std::vector<double> zone_data(mesh.num_zones);
+
+  gather<ExecPolicy>(mesh, zone_data, state);
+}
+
+BENCHMARK_TEMPLATE(benchmark_gather_file_order, RAJA::loop_exec);
+BENCHMARK_TEMPLATE2(benchmark_gather_curve_order,
+                    RAJA::loop_exec,
+                    RAJA::box_order::morton);
+BENCHMARK_TEMPLATE2(benchmark_gather_curve_order,
+                    RAJA::loop_exec,
+                    RAJA::box_order::hilbert);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_gather_file_order, RAJA::omp_parallel_for_exec);
+BENCHMARK_TEMPLATE2(benchmark_gather_curve_order,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::box_order::morton);
+BENCHMARK_TEMPLATE2(benchmark_gather_curve_order,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::box_order::hilbert);
+#endif
+
+BENCHMARK_MAIN();
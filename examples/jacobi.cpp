@@ -301,6 +301,73 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 #endif
 
 
+  printf("RAJA: Temporal blocking \n");
+  resI2 = 1;
+  iteration = 0;
+  memset(I, 0, NN * sizeof(double));
+  memset(Iold, 0, NN * sizeof(double));
+
+  /*
+   *  Temporally blocked Jacobi Iteration.
+   *
+   *  RAJA::temporal_block runs several Jacobi sweeps on a block of rows
+   *  while it is in cache. Sweep t reads iterate t and writes iterate
+   *  t + 1, which alternate between the Iold and I arrays. The residual
+   *  is checked after every checkIter sweeps, an even number so the
+   *  latest iterate is back in Iold.
+   *
+   *  The blocks are rows of the grid, and each sweep reads rows at most
+   *  one away, so the stencil radius along rows is 1.
+   */
+#if defined(RAJA_ENABLE_OPENMP)
+  using jacobiTemporalPolicy = RAJA::omp_parallel_for_exec;
+#else
+  using jacobiTemporalPolicy = RAJA::seq_exec;
+#endif
+
+  const int checkIter = 16;
+  const RAJA::TemporalTiling jacobiTiling{1, 16, 8};
+
+  while (resI2 > tol * tol) {
+
+    RAJA::temporal_block<jacobiTemporalPolicy>(checkIter, jacobiTiling,
+                         RAJA::make_tuple(jacobiRange, jacobiRange),
+                         [=] (RAJA::Index_type t, RAJA::Index_type n,
+                              RAJA::Index_type m) {
+
+      const double *Iin = (t % 2 == 0) ? Iold : I;
+      double *Iout = (t % 2 == 0) ? I : Iold;
+
+      double x = gridx.o + m * gridx.h;
+      double y = gridx.o + n * gridx.h;
+
+      double f = gridx.h * gridx.h *
+                 (2 * x * (y - 1) * (y - 2 * x + x * y + 2) * exp(x - y));
+
+      int id = n * (N + 2) + m;
+      Iout[id] = 0.25 * (-f + Iin[id - N - 2] + Iin[id + N + 2] +
+                              Iin[id - 1] + Iin[id + 1]);
+    });
+
+    RAJA::ReduceSum<RAJA::seq_reduce, double> RAJA_resI2(0.0);
+    RAJA::forall<RAJA::seq_exec>(
+      gridRange, [=](RAJA::Index_type k) {
+
+        RAJA_resI2 += (I[k] - Iold[k]) * (I[k] - Iold[k]);
+
+      });
+
+    resI2 = RAJA_resI2;
+    if (iteration > maxIter) {
+      printf("Jacobi: Temporal blocking - Maxed out on iterations! \n");
+      exit(-1);
+    }
+    iteration += checkIter;
+  }
+  computeErr(Iold, gridx);
+  printf("No of iterations: %d \n \n", iteration);
+
+
 #if defined(RAJA_ENABLE_CUDA)
   /*
    *  CUDA Jacobi Iteration. 
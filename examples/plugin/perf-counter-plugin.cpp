@@ -0,0 +1,385 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Hardware performance counter plugin based on Linux perf_event.
+//
+// The plugin is meant to be loaded at runtime, e.g.
+//
+//   RAJA_PLUGINS=/path/to/libperf_counter_plugin.so ./app
+//
+// Around every launch it reads cycles, instructions, last level cache misses
+// and branch misses for all threads of the process and attributes the
+// difference to the kernel (by PluginContext::kernel_name) and platform.
+// A per-kernel report with IPC, cache miss traffic and branch miss rates is
+// printed at finalize(), or at exit if finalize_plugins() is never called.
+// Threads created during a launch are counted from the next launch on.
+//
+// Optionally, RAJA_PERF_FLOPS_EVENT may name a raw, CPU-specific counter
+// (hex config of a PERF_TYPE_RAW event, e.g. an FP_ARITH_INST_RETIRED umask
+// combination) counting floating point operations; bytes per flop is then
+// reported too. Only user-space events are counted, so the default
+// perf_event_paranoid setting (2) is sufficient.
+//
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+
+constexpr int num_fixed_events = 4;
+constexpr int max_events = num_fixed_events + 1;
+
+const char* const event_names[max_events] =
+    {"cycles", "instructions", "llc_misses", "branch_misses", "flops"};
+
+using Counts = std::array<double, max_events>;
+
+long perfEventOpen(perf_event_attr* attr, pid_t tid, int group_fd)
+{
+  return ::syscall(__NR_perf_event_open, attr, tid, -1, group_fd, 0);
+}
+
+//
+// One counter group (leader plus members) attached to one thread; read
+// with a single read() and scaled for multiplexing.
+//
+struct ThreadCounters {
+  pid_t tid{-1};
+  int fds[max_events];
+  int num{0};
+
+  ThreadCounters() { std::fill(fds, fds + max_events, -1); }
+
+  bool open(pid_t thread, bool with_flops, uint64_t flops_config)
+  {
+    tid = thread;
+    const uint64_t configs[num_fixed_events] = {PERF_COUNT_HW_CPU_CYCLES,
+                                                PERF_COUNT_HW_INSTRUCTIONS,
+                                                PERF_COUNT_HW_CACHE_MISSES,
+                                                PERF_COUNT_HW_BRANCH_MISSES};
+    const int total = with_flops ? max_events : num_fixed_events;
+    for (int e = 0; e < total; ++e) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = e < num_fixed_events ? PERF_TYPE_HARDWARE : PERF_TYPE_RAW;
+      attr.config = e < num_fixed_events ? configs[e] : flops_config;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+      const long fd = perfEventOpen(&attr, thread, e == 0 ? -1 : fds[0]);
+      if (fd < 0) {
+        close();
+        return false;
+      }
+      fds[e] = static_cast<int>(fd);
+      num = e + 1;
+    }
+    return true;
+  }
+
+  void close()
+  {
+    for (int e = 0; e < max_events; ++e) {
+      if (fds[e] >= 0) ::close(fds[e]);
+      fds[e] = -1;
+    }
+    num = 0;
+  }
+
+  // Adds the (multiplexing scaled) counts of this thread to sum
+  void accumulate(Counts& sum) const
+  {
+    if (num == 0) return;
+    uint64_t buf[3 + max_events];
+    const ssize_t expected =
+        static_cast<ssize_t>((3 + num) * sizeof(uint64_t));
+    if (::read(fds[0], buf, sizeof(buf)) < expected) return;
+    // buf = { nr, time_enabled, time_running, value[nr] }
+    const uint64_t enabled = buf[1];
+    const uint64_t running = buf[2];
+    if (running == 0) return;
+    const double scale = static_cast<double>(enabled) / running;
+    for (int e = 0; e < num; ++e) {
+      sum[e] += buf[3 + e] * scale;
+    }
+  }
+};
+
+struct KernelCounts {
+  uint64_t launches{0};
+  uint64_t iterations{0};
+  double seconds{0.0};
+  Counts counts{};
+};
+
+struct LaunchStart {
+  std::chrono::steady_clock::time_point time;
+  Counts counts;
+};
+
+const char* platformName(RAJA::Platform p)
+{
+  switch (p) {
+    case RAJA::Platform::host:
+      return "host";
+    case RAJA::Platform::cuda:
+      return "cuda";
+    case RAJA::Platform::hip:
+      return "hip";
+    case RAJA::Platform::omp_target:
+      return "omp_target";
+    case RAJA::Platform::sycl:
+      return "sycl";
+    default:
+      return "undefined";
+  }
+}
+
+thread_local std::vector<LaunchStart> launch_starts;
+
+}  // namespace
+
+class PerfCounterPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  PerfCounterPlugin()
+  {
+    const char* flops = ::getenv("RAJA_PERF_FLOPS_EVENT");
+    if (flops) {
+      with_flops = true;
+      flops_config = std::strtoull(flops, nullptr, 16);
+    }
+    const long line = ::sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+    line_size = line > 0 ? static_cast<double>(line) : 64.0;
+    stat_fd = ::open("/proc/self/stat", O_RDONLY | O_CLOEXEC);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    refreshThreads();
+    if (threads.empty()) {
+      printf("[PerfCounterPlugin]: perf_event_open failed (%s), "
+             "check /proc/sys/kernel/perf_event_paranoid\n",
+             std::strerror(errno));
+    }
+  }
+
+  ~PerfCounterPlugin()
+  {
+    finalize();
+    for (auto& t : threads) {
+      t.close();
+    }
+    if (stat_fd >= 0) ::close(stat_fd);
+  }
+
+  void preLaunch(const RAJA::util::PluginContext&) override
+  {
+    // Worker threads (e.g. an OpenMP pool) are created by the first
+    // parallel launch; attach counters to them once they show up. The
+    // thread count is checked with a single pread outside the lock, the
+    // thread list is only rescanned when it changes.
+    const size_t tasks = numThreads();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tasks != num_tasks) {
+      refreshThreads();
+    }
+
+    LaunchStart start;
+    start.counts = readCounts();
+    start.time = std::chrono::steady_clock::now();
+    launch_starts.push_back(start);
+  }
+
+  void postLaunch(const RAJA::util::PluginContext& p) override
+  {
+    const auto end_time = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const Counts end = readCounts();
+    if (launch_starts.empty()) return;
+    const LaunchStart start = launch_starts.back();
+    launch_starts.pop_back();
+
+    KernelCounts& k = kernels[std::make_pair(
+        std::string(p.kernel_name ? p.kernel_name : "(unnamed)"),
+        p.platform)];
+    ++k.launches;
+    k.iterations += p.iteration_size;
+    k.seconds += std::chrono::duration<double>(end_time - start.time).count();
+    for (int e = 0; e < max_events; ++e) {
+      k.counts[e] += std::max(0.0, end[e] - start.counts[e]);
+    }
+  }
+
+  void finalize() override
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (reported || kernels.empty()) return;
+    reported = true;
+    report();
+  }
+
+private:
+  using key_type = std::pair<std::string, RAJA::Platform>;
+
+  // Number of threads in the process, from /proc/self/stat; pread on the
+  // descriptor opened at init does not touch shared state, so no lock
+  size_t numThreads() const
+  {
+    if (stat_fd < 0) return num_tasks;
+    char buf[1024];
+    const ssize_t len = ::pread(stat_fd, buf, sizeof(buf) - 1, 0);
+    if (len <= 0) return num_tasks;
+    buf[len] = '\0';
+
+    // num_threads is the 18th field after the parenthesized command name
+    const char* field = std::strrchr(buf, ')');
+    for (int i = 0; field && i < 18; ++i) {
+      field = std::strchr(field + 1, ' ');
+    }
+    return field ? static_cast<size_t>(std::atol(field + 1))
+                 : num_tasks.load();
+  }
+
+  // Called with the mutex held
+  void refreshThreads()
+  {
+    DIR* dir = ::opendir("/proc/self/task");
+    if (!dir) return;
+
+    std::vector<pid_t> current;
+    while (struct dirent* entry = ::readdir(dir)) {
+      if (entry->d_name[0] == '.') continue;
+      current.push_back(static_cast<pid_t>(std::atoi(entry->d_name)));
+    }
+    ::closedir(dir);
+    std::sort(current.begin(), current.end());
+    num_tasks = current.size();
+
+    // close counters of threads that have exited
+    std::vector<ThreadCounters> kept;
+    for (auto& t : threads) {
+      if (std::binary_search(current.begin(), current.end(), t.tid)) {
+        kept.push_back(t);
+      } else {
+        t.close();
+      }
+    }
+    threads.swap(kept);
+
+    for (pid_t tid : current) {
+      const bool known = std::any_of(threads.begin(),
+                                     threads.end(),
+                                     [=](const ThreadCounters& t) {
+                                       return t.tid == tid;
+                                     });
+      if (!known) {
+        ThreadCounters t;
+        if (t.open(tid, with_flops, flops_config)) {
+          threads.push_back(t);
+        }
+      }
+    }
+  }
+
+  // Called with the mutex held
+  Counts readCounts() const
+  {
+    Counts sum{};
+    for (const auto& t : threads) {
+      t.accumulate(sum);
+    }
+    return sum;
+  }
+
+  void report() const
+  {
+    using entry_type = std::pair<key_type, KernelCounts>;
+    std::vector<entry_type> sorted(kernels.begin(), kernels.end());
+    std::sort(sorted.begin(),
+              sorted.end(),
+              [](const entry_type& a, const entry_type& b) {
+                return a.second.counts[0] > b.second.counts[0];
+              });
+
+    printf("[PerfCounterPlugin]: hardware counters per kernel "
+           "(all threads, user space, sorted by cycles)\n");
+    for (const auto& entry : sorted) {
+      const KernelCounts& k = entry.second;
+      const double cycles = k.counts[0];
+      const double instructions = k.counts[1];
+      const double llc_misses = k.counts[2];
+      const double branch_misses = k.counts[3];
+      const double bytes = llc_misses * line_size;
+
+      printf("[PerfCounterPlugin]: %s [%s]\n",
+             entry.first.first.c_str(),
+             platformName(entry.first.second));
+      printf("    launches %llu, iterations %llu, time %.6f s\n",
+             static_cast<unsigned long long>(k.launches),
+             static_cast<unsigned long long>(k.iterations),
+             k.seconds);
+      for (int e = 0; e < (with_flops ? max_events : num_fixed_events); ++e) {
+        printf("    %-14s %.0f\n", event_names[e], k.counts[e]);
+      }
+      printf("    IPC %.3f, LLC miss bytes/iteration %.3f, "
+             "LLC MPKI %.3f, branch MPKI %.3f, est. DRAM bandwidth %.3f GB/s\n",
+             cycles > 0 ? instructions / cycles : 0.0,
+             k.iterations ? bytes / k.iterations : 0.0,
+             instructions > 0 ? 1000.0 * llc_misses / instructions : 0.0,
+             instructions > 0 ? 1000.0 * branch_misses / instructions : 0.0,
+             k.seconds > 0 ? bytes / k.seconds * 1.0e-9 : 0.0);
+      if (with_flops) {
+        const double flops = k.counts[num_fixed_events];
+        printf("    bytes/flop %.3f, GFLOP/s %.3f\n",
+               flops > 0 ? bytes / flops : 0.0,
+               k.seconds > 0 ? flops / k.seconds * 1.0e-9 : 0.0);
+      }
+    }
+  }
+
+  std::mutex mutex;
+  int stat_fd{-1};
+  std::atomic<size_t> num_tasks{0};
+  std::vector<ThreadCounters> threads;
+  std::map<key_type, KernelCounts> kernels;
+  bool with_flops{false};
+  uint64_t flops_config{0};
+  double line_size{64.0};
+  bool reported{false};
+};
+
+// Dynamically loading plugin.
+extern "C" RAJA::util::PluginStrategy *getPlugin()
+{
+  return new PerfCounterPlugin;
+}
@@ -411,6 +411,184 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   checkResult<double>(Cview, N);
 //printResult<double>(Cview, N);
+
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n Running OpenMP tiled mat-mult with team shared memory...\n";
+
+  std::memset(C, 0, N*N * sizeof(double));
+
+  //
+  // This example uses the same tiled algorithm as the GPU shared memory
+  // versions below. Row tiles are distributed across OpenMP threads and
+  // each thread executes a whole team at a time. Team shared memory is
+  // reserved through the Grid and, on the host, is a per-thread scratchpad
+  // that is small enough to stay resident in cache.
+  //
+  using omp_tile_policy = RAJA::expt::LoopPolicy<RAJA::omp_for_exec>;
+  using host_loop = RAJA::expt::LoopPolicy<loop_policy>;
+
+  RAJA::RangeSegment host_dot_range(0, N);
+  const size_t tile_bytes = 3 * THREAD_SZ * THREAD_SZ * sizeof(double);
+
+  RAJA::expt::launch<omp_launch_policy>(RAJA::expt::HOST,
+    RAJA::expt::Grid(RAJA::expt::Teams(NTeams, NTeams),
+                     RAJA::expt::Threads(THREAD_SZ, THREAD_SZ),
+                     tile_bytes),
+    [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+   RAJA::expt::tile<omp_tile_policy>
+     (ctx, THREAD_SZ, row_range, [&] (RAJA::RangeSegment const &y_tile) {
+     RAJA::expt::tile<host_loop>
+       (ctx, THREAD_SZ, col_range, [&] (RAJA::RangeSegment const &x_tile) {
+
+         using TileView = RAJA::View<double, RAJA::Layout<DIM>>;
+         TileView As(ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ),
+                     THREAD_SZ, THREAD_SZ);
+         TileView Bs(ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ),
+                     THREAD_SZ, THREAD_SZ);
+         TileView Cs(ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ),
+                     THREAD_SZ, THREAD_SZ);
+
+         RAJA::expt::loop_icount<host_loop>(ctx, y_tile, [&](int row, int ty) {
+             RAJA::expt::loop_icount<host_loop>(ctx, x_tile, [&](int col, int tx) {
+               Cs(ty, tx) = 0.0;
+             });
+         });
+
+         RAJA::expt::tile<host_loop>
+           (ctx, THREAD_SZ, host_dot_range, [&] (RAJA::RangeSegment const &k_tile) {
+
+           RAJA::expt::loop_icount<host_loop>(ctx, y_tile, [&](int row, int ty) {
+               RAJA::expt::loop_icount<host_loop>(ctx, k_tile, [&](int k_id, int tx) {
+                   As(ty, tx) = Aview(row, k_id);
+                 });
+             });
+
+           RAJA::expt::loop_icount<host_loop>(ctx, k_tile, [&](int k_id, int ty) {
+               RAJA::expt::loop_icount<host_loop>(ctx, x_tile, [&](int col, int tx) {
+                   Bs(ty, tx) = Bview(k_id, col);
+               });
+             });
+
+           ctx.teamSync();
+
+           RAJA::expt::loop_icount<host_loop>(ctx, y_tile, [&](int row, int ty) {
+               RAJA::expt::loop_icount<host_loop>(ctx, x_tile, [&](int col, int tx) {
+
+                   RAJA::expt::loop_icount<host_loop>(ctx, k_tile, [&] (int gid, int e) {
+                       Cs(ty, tx) += As(ty, e) * Bs(e, tx);
+                     });
+
+                 });
+             });
+
+           ctx.teamSync();
+
+         });  // slide across matrix
+
+         RAJA::expt::loop_icount<host_loop>(ctx, y_tile, [&](int row, int ty) {
+             RAJA::expt::loop_icount<host_loop>(ctx, x_tile, [&](int col, int tx) {
+                 Cview(row, col) = Cs(ty, tx);
+             });
+         });
+
+         ctx.releaseSharedMemory();
+       });
+     });
+  });  // kernel
+
+  checkResult<double>(Cview, N);
+//printResult<double>(Cview, N);
+
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n Running OpenMP nested teams mat-mult with team shared memory...\n";
+
+  std::memset(C, 0, N*N * sizeof(double));
+
+  //
+  // This example maps teams to groups of OpenMP threads. Groups are spread
+  // across the OpenMP places (e.g., OMP_PLACES=cores or sockets) and the
+  // threads of a group share the team's scratch memory, which stays in the
+  // cache of the place the group is bound to. Thread loops are work-shared
+  // within a group, and teamSync() is a barrier across the group.
+  //
+  using omp_nested_launch_policy =
+      RAJA::expt::LaunchPolicy<RAJA::expt::omp_nested_launch_t<>>;
+  using omp_team_policy =
+      RAJA::expt::LoopPolicy<RAJA::expt::omp_team_distribute_exec>;
+  using omp_thread_policy = RAJA::expt::LoopPolicy<RAJA::omp_for_exec>;
+
+  RAJA::expt::launch<omp_nested_launch_policy>(RAJA::expt::HOST,
+    RAJA::expt::Grid(RAJA::expt::Teams(NTeams, NTeams),
+                     RAJA::expt::Threads(THREAD_SZ, THREAD_SZ),
+                     tile_bytes),
+    [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+   RAJA::expt::tile<omp_team_policy>
+     (ctx, THREAD_SZ, row_range, [&] (RAJA::RangeSegment const &y_tile) {
+     RAJA::expt::tile<host_loop>
+       (ctx, THREAD_SZ, col_range, [&] (RAJA::RangeSegment const &x_tile) {
+
+         using TileView = RAJA::View<double, RAJA::Layout<DIM>>;
+         TileView As(ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ),
+                     THREAD_SZ, THREAD_SZ);
+         TileView Bs(ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ),
+                     THREAD_SZ, THREAD_SZ);
+         TileView Cs(ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ),
+                     THREAD_SZ, THREAD_SZ);
+
+         RAJA::expt::loop_icount<omp_thread_policy>(ctx, y_tile, [&](int row, int ty) {
+             RAJA::expt::loop_icount<host_loop>(ctx, x_tile, [&](int col, int tx) {
+               Cs(ty, tx) = 0.0;
+             });
+         });
+
+         RAJA::expt::tile<host_loop>
+           (ctx, THREAD_SZ, host_dot_range, [&] (RAJA::RangeSegment const &k_tile) {
+
+           RAJA::expt::loop_icount<omp_thread_policy>(ctx, y_tile, [&](int row, int ty) {
+               RAJA::expt::loop_icount<host_loop>(ctx, k_tile, [&](int k_id, int tx) {
+                   As(ty, tx) = Aview(row, k_id);
+                 });
+             });
+
+           RAJA::expt::loop_icount<omp_thread_policy>(ctx, k_tile, [&](int k_id, int ty) {
+               RAJA::expt::loop_icount<host_loop>(ctx, x_tile, [&](int col, int tx) {
+                   Bs(ty, tx) = Bview(k_id, col);
+               });
+             });
+
+           ctx.teamSync();
+
+           RAJA::expt::loop_icount<omp_thread_policy>(ctx, y_tile, [&](int row, int ty) {
+               RAJA::expt::loop_icount<host_loop>(ctx, x_tile, [&](int col, int tx) {
+
+                   RAJA::expt::loop_icount<host_loop>(ctx, k_tile, [&] (int gid, int e) {
+                       Cs(ty, tx) += As(ty, e) * Bs(e, tx);
+                     });
+
+                 });
+             });
+
+           ctx.teamSync();
+
+         });  // slide across matrix
+
+         RAJA::expt::loop_icount<omp_thread_policy>(ctx, y_tile, [&](int row, int ty) {
+             RAJA::expt::loop_icount<host_loop>(ctx, x_tile, [&](int col, int tx) {
+                 Cview(row, col) = Cs(ty, tx);
+             });
+         });
+
+         ctx.releaseSharedMemory();
+       });
+     });
+  });  // kernel
+
+  checkResult<double>(Cview, N);
+//printResult<double>(Cview, N);
 #endif // if RAJA_ENABLE_OPENMP
 
 //----------------------------------------------------------------------------//
@@ -181,6 +181,35 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   checkResult<int>(Atview, N_c, N_r);
   // printResult<int>(Atview, N_c, N_r);
 
+//----------------------------------------------------------------------------//
+  std::cout << "\n Running sequential cache-oblivious matrix transpose ...\n";
+  std::memset(At, 0, N_r * N_c * sizeof(int));
+
+  //
+  // The following policy recursively halves the longer side of the matrix
+  // until tiles are at most TILE_DIM on a side, so the tiles nest to fit
+  // every cache level without choosing a tile size for each.
+  //
+  using KERNEL_EXEC_POL_REC =
+    RAJA::KernelPolicy<
+      RAJA::statement::RecursiveTile<RAJA::ArgList<0, 1>,
+                                     RAJA::cache_oblivious_exec<TILE_DIM>,
+        RAJA::statement::For<1, RAJA::seq_exec,
+          RAJA::statement::For<0, RAJA::seq_exec,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >;
+
+  RAJA::kernel<KERNEL_EXEC_POL_REC>( RAJA::make_tuple(col_Range, row_Range),
+    [=](int col, int row) {
+      Atview(col, row) = Aview(row, col);
+  });
+
+  checkResult<int>(Atview, N_c, N_r);
+  // printResult<int>(Atview, N_c, N_r);
+
 //----------------------------------------------------------------------------//
 #if defined(RAJA_ENABLE_OPENMP)
   std::cout << "\n Running openmp tiled matrix transpose -  parallel top inner loop...\n";
@@ -247,6 +276,38 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   checkResult<int>(Atview, N_c, N_r);
   // printResult<int>(Atview, N_c, N_r);
+  //----------------------------------------------------------------------------//
+
+  std::cout << "\n Running openmp cache-oblivious matrix transpose...\n";
+
+  std::memset(At, 0, N_r * N_c * sizeof(int));
+
+  //
+  // This policy runs the subtrees below the first four levels of the
+  // recursive tiling in parallel, as OpenMP tasks.
+  //
+  using KERNEL_EXEC_POL_OMP_REC =
+    RAJA::KernelPolicy<
+      RAJA::statement::RecursiveTile<RAJA::ArgList<0, 1>,
+                                     RAJA::omp_cache_oblivious_exec<TILE_DIM, 4>,
+        RAJA::statement::For<1, RAJA::seq_exec,
+          RAJA::statement::For<0, RAJA::seq_exec,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >;
+
+  RAJA::kernel<KERNEL_EXEC_POL_OMP_REC>(
+                        RAJA::make_tuple(col_Range, row_Range),
+                        [=](int col, int row) {
+
+    Atview(col, row) = Aview(row, col);
+
+  });
+
+  checkResult<int>(Atview, N_c, N_r);
+  // printResult<int>(Atview, N_c, N_r);
 
 #endif
 
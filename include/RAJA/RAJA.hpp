@@ -30,6 +30,8 @@
 
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/numa_allocator.hpp"
+#include "RAJA/util/affinity_schedule.hpp"
 #include "RAJA/util/camp_aliases.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -90,6 +92,9 @@
 #endif
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/BitmaskSegment.hpp"
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
 
 //
 // Strongly typed index class
@@ -102,7 +107,9 @@
 // in the files included below.
 //
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/forall_fused.hpp"
 #include "RAJA/pattern/region.hpp"
+#include "RAJA/pattern/temporal.hpp"
 
 #include "RAJA/policy/MultiPolicy.hpp"
 
@@ -182,10 +189,14 @@
 
 #include "RAJA/pattern/scan.hpp"
 
-#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS) || defined(RAJA_ENABLE_TRACE_PLUGIN)
 #include "RAJA/util/PluginLinker.hpp"
 #endif
 
 #include "RAJA/pattern/sort.hpp"
 
+#include "RAJA/pattern/pipeline.hpp"
+
+#include "RAJA/util/SpaceFillingCurve.hpp"
+
 #endif  // closing endif for header file include guard
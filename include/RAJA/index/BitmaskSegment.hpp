@@ -0,0 +1,565 @@
+/*!
+ ******************************************************************************
+ *
+ * \file BitmaskSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA bitmask segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BitmaskSegment_HPP
+#define RAJA_BitmaskSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#if defined(RAJA_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/ListSegment.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Index of the lowest set bit of a non-zero word
+RAJA_INLINE RAJA_HOST_DEVICE int count_trailing_zeros(uint64_t word)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __ffsll(static_cast<long long>(word)) - 1;
+#elif defined(RAJA_COMPILER_MSVC)
+  unsigned long index;
+  _BitScanForward64(&index, word);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctzll(word);
+#endif
+}
+
+//! Number of set bits of a word
+RAJA_INLINE int population_count(uint64_t word)
+{
+#if defined(RAJA_COMPILER_MSVC)
+  return static_cast<int>(__popcnt64(word));
+#else
+  return __builtin_popcountll(word);
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedBitmaskSegment
+ *
+ * \brief  Segment class representing the indices whose bits are set in a
+ *         bitmap.
+ *
+ * \tparam StorageT underlying data type for the segment indices (required)
+ *
+ * Bit k of word w of the bitmap stands for index begin + 64 * w + k, for
+ * indices in the interval [begin, end). The bitmap lives in host memory.
+ *
+ * The segment counts the set bits of each word when it is constructed, so
+ * it must be constructed again after the bitmap changes. That costs one
+ * pass over the bitmap, which is much less than building a list of the
+ * indices.
+ *
+ * A TypedBitmaskSegment models an Iterable interface:
+ *
+ *  begin() -- returns a random access iterator over the set indices
+ *  end() -- returns a random access iterator over the set indices
+ *  size() -- returns number of set indices (RAJA::Index_type)
+ *
+ * The seq, loop, simd, OpenMP and TBB forall policies visit the set bits of
+ * each word, skipping zero words and runs of zero bits. The parallel
+ * policies split the bitmap on word boundaries.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * std::vector<uint64_t> active((num_zones + 63) / 64);
+ * // set bits of active zones
+ * TypedBitmaskSegment<int> seg(active.data(), 0, num_zones);
+ *
+ * forall<exec_pol>(seg, [=] (int i) {
+ *   // loop body -- use i as index value
+ * });
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT>
+class TypedBitmaskSegment
+{
+public:
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Number of indices represented by each bitmap word
+  static constexpr Index_type bits_per_word = 64;
+
+  //@}
+
+  /*!
+   * \brief Random access iterator over the set indices of the segment.
+   *
+   * Dereferencing finds the word holding the set bit by binary search of
+   * the per-word counts, so the forall policies that visit words directly
+   * are much faster than traversal through the iterator. Like a list
+   * segment iterator, it points at the bitmap and the word counts rather
+   * than at the segment, so it stays valid while they do.
+   */
+  class iterator
+  {
+  public:
+    using value_type = StorageT;
+    using difference_type = Index_type;
+    using pointer = value_type*;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    RAJA_HOST_DEVICE iterator()
+        : m_bits(nullptr),
+          m_ranks(nullptr),
+          m_num_words(0),
+          m_begin(0),
+          m_end(0),
+          m_pos(0)
+    {
+    }
+
+    RAJA_HOST_DEVICE iterator(const uint64_t* bits,
+                              const Index_type* ranks,
+                              Index_type num_words,
+                              value_type begin,
+                              value_type end,
+                              Index_type pos)
+        : m_bits(bits),
+          m_ranks(ranks),
+          m_num_words(num_words),
+          m_begin(begin),
+          m_end(end),
+          m_pos(pos)
+    {
+    }
+
+    RAJA_HOST_DEVICE value_type operator*() const { return index(m_pos); }
+
+    RAJA_HOST_DEVICE value_type operator[](difference_type n) const
+    {
+      return index(m_pos + n);
+    }
+
+    RAJA_HOST_DEVICE iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    RAJA_HOST_DEVICE iterator& operator+=(difference_type n)
+    {
+      m_pos += n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator-=(difference_type n)
+    {
+      m_pos -= n;
+      return *this;
+    }
+
+    RAJA_HOST_DEVICE iterator operator+(difference_type n) const
+    {
+      iterator tmp(*this);
+      tmp.m_pos += n;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE iterator operator-(difference_type n) const
+    {
+      iterator tmp(*this);
+      tmp.m_pos -= n;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE friend iterator operator+(difference_type n,
+                                               const iterator& it)
+    {
+      return it + n;
+    }
+    RAJA_HOST_DEVICE difference_type operator-(const iterator& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+    RAJA_HOST_DEVICE bool operator==(const iterator& rhs) const
+    {
+      return m_pos == rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator!=(const iterator& rhs) const
+    {
+      return m_pos != rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<(const iterator& rhs) const
+    {
+      return m_pos < rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>(const iterator& rhs) const
+    {
+      return m_pos > rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<=(const iterator& rhs) const
+    {
+      return m_pos <= rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>=(const iterator& rhs) const
+    {
+      return m_pos >= rhs.m_pos;
+    }
+
+  private:
+    //
+    // Index of set bit number pos, found in the last word with no more
+    // than pos set bits before it
+    //
+    RAJA_HOST_DEVICE value_type index(Index_type pos) const
+    {
+      Index_type w = 0;
+      Index_type hi = m_num_words;
+      while (hi - w > 1) {
+        const Index_type mid = w + (hi - w) / 2;
+        if (m_ranks[mid] <= pos) {
+          w = mid;
+        } else {
+          hi = mid;
+        }
+      }
+
+      uint64_t bits = maskWord(m_bits, m_begin, m_end, w);
+      for (Index_type k = pos - m_ranks[w]; k > 0; --k) {
+        bits &= bits - 1;
+      }
+      return static_cast<value_type>(m_begin + w * bits_per_word +
+                                     detail::count_trailing_zeros(bits));
+    }
+
+    const uint64_t* m_bits;
+    const Index_type* m_ranks;
+    Index_type m_num_words;
+    value_type m_begin;
+    value_type m_end;
+    Index_type m_pos;
+  };
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a bitmask segment that is a view of the given bitmap.
+   *
+   * \param bits bitmap of at least (end - begin + 63) / 64 words
+   * \param begin index represented by the first bit of the bitmap
+   * \param end one past the last index represented by the bitmap
+   *
+   * The segment does not own or copy the bitmap. Caller must manage its
+   * lifetime properly, and construct the segment again after changing it.
+   * Bits for indices at or beyond end are ignored.
+   */
+  TypedBitmaskSegment(const uint64_t* bits, value_type begin, value_type end)
+      : m_bits(bits), m_begin(begin), m_end(end < begin ? begin : end)
+  {
+    initRanks();
+  }
+
+  /*!
+   * \brief Construct a bitmask segment holding the indices of a list
+   *        segment.
+   *
+   * \param list list segment whose indices live in host memory space
+   *
+   * The segment owns a bitmap spanning the smallest to the largest index of
+   * the list. Its indices are in increasing order, without duplicates.
+   * The list must not hold the largest value of StorageT, since the end of
+   * the bitmap would not be representable.
+   */
+  explicit TypedBitmaskSegment(const TypedListSegment<StorageT>& list)
+      : m_bits(nullptr), m_begin(0), m_end(0)
+  {
+    if (list.size() > 0) {
+      const value_type last = *std::max_element(list.begin(), list.end());
+      if (last == std::numeric_limits<value_type>::max()) {
+        RAJA_ABORT_OR_THROW(
+            "TypedBitmaskSegment cannot hold the largest value of its "
+            "index type");
+      }
+      m_begin = *std::min_element(list.begin(), list.end());
+      m_end = static_cast<value_type>(last + 1);
+
+      auto bits = std::make_shared<std::vector<uint64_t>>(
+          numWords(m_begin, m_end), 0);
+      for (auto idx : list) {
+        Index_type bit = span(m_begin, idx);
+        (*bits)[bit / bits_per_word] |= uint64_t(1) << (bit % bits_per_word);
+      }
+      m_bits = bits->data();
+      m_bit_data = bits;
+    }
+    initRanks();
+  }
+
+  //! Disable compiler generated constructor
+  TypedBitmaskSegment() = delete;
+
+  //! Copy constructor, sharing the bitmap and word counts
+  TypedBitmaskSegment(const TypedBitmaskSegment&) = default;
+
+  //! Move constructor
+  TypedBitmaskSegment(TypedBitmaskSegment&&) = default;
+
+  //! Bitmask segment destructor
+  ~TypedBitmaskSegment() = default;
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  iterator begin() const
+  {
+    return iterator(m_bits, m_ranks->data(), getNumWords(), m_begin, m_end, 0);
+  }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  iterator end() const
+  {
+    return iterator(
+        m_bits, m_ranks->data(), getNumWords(), m_begin, m_end, m_size);
+  }
+
+  /*!
+   * \brief Get size of this segment (number of set indices)
+   */
+  Index_type size() const { return m_size; }
+
+  /*!
+   * \brief Get number of words of the bitmap
+   */
+  Index_type getNumWords() const { return numWords(m_begin, m_end); }
+
+  /*!
+   * \brief Get word of the bitmap, without bits for indices beyond end
+   */
+  uint64_t getWord(Index_type word) const
+  {
+    return maskWord(m_bits, m_begin, m_end, word);
+  }
+
+  /*!
+   * \brief Call body with each set index of the words in
+   *        [first_word, last_word), in increasing order
+   */
+  template <typename Func>
+  RAJA_INLINE void visitWords(Index_type first_word,
+                              Index_type last_word,
+                              Func&& body) const
+  {
+    for (Index_type w = first_word; w < last_word; ++w) {
+      uint64_t bits = getWord(w);
+      const value_type base =
+          static_cast<value_type>(m_begin + w * bits_per_word);
+      while (bits != 0) {
+        body(static_cast<value_type>(base +
+                                     detail::count_trailing_zeros(bits)));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+  /*!
+   * \brief Return list segment holding the set indices of this segment
+   *
+   * \param resource camp resource defining memory space where list segment
+   *        index data live
+   */
+  TypedListSegment<StorageT> toListSegment(
+      camp::resources::Resource resource) const
+  {
+    std::vector<value_type> indices;
+    indices.reserve(m_size);
+    visitWords(0, getNumWords(), [&](value_type i) { indices.push_back(i); });
+    return TypedListSegment<StorageT>(indices, resource);
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if both segments hold the same set indices, else false
+   */
+  bool operator==(const TypedBitmaskSegment& other) const
+  {
+    return m_size == other.m_size && std::equal(begin(), end(), other.begin());
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   */
+  bool operator!=(const TypedBitmaskSegment& other) const
+  {
+    return !(*this == other);
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  void swap(TypedBitmaskSegment& other)
+  {
+    camp::safe_swap(m_bits, other.m_bits);
+    camp::safe_swap(m_begin, other.m_begin);
+    camp::safe_swap(m_end, other.m_end);
+    camp::safe_swap(m_size, other.m_size);
+    camp::safe_swap(m_bit_data, other.m_bit_data);
+    camp::safe_swap(m_ranks, other.m_ranks);
+  }
+
+private:
+  //
+  // Number of indices in [begin, end), computed in Index_type so it does
+  // not overflow value_type
+  //
+  RAJA_HOST_DEVICE static Index_type span(value_type begin, value_type end)
+  {
+    return static_cast<Index_type>(end) - static_cast<Index_type>(begin);
+  }
+
+  static Index_type numWords(value_type begin, value_type end)
+  {
+    return (span(begin, end) + bits_per_word - 1) / bits_per_word;
+  }
+
+  //
+  // Word of the bitmap, without bits for indices at or beyond end
+  //
+  RAJA_HOST_DEVICE static uint64_t maskWord(const uint64_t* bits,
+                                            value_type begin,
+                                            value_type end,
+                                            Index_type word)
+  {
+    uint64_t w = bits[word];
+    const Index_type tail = span(begin, end) - word * bits_per_word;
+    if (tail < bits_per_word) {
+      w &= (uint64_t(1) << tail) - 1;
+    }
+    return w;
+  }
+
+  //
+  // Count the set bits before each word
+  //
+  void initRanks()
+  {
+    const Index_type num_words = getNumWords();
+    auto ranks = std::make_shared<std::vector<Index_type>>(num_words);
+    Index_type count = 0;
+    for (Index_type w = 0; w < num_words; ++w) {
+      (*ranks)[w] = count;
+      count += detail::population_count(getWord(w));
+    }
+    m_size = count;
+    m_ranks = ranks;
+  }
+
+  // Bitmap, owned by m_bit_data if built by the segment
+  const uint64_t* m_bits;
+
+  // Indices represented by the bitmap
+  value_type m_begin;
+  value_type m_end;
+
+  // Number of set indices
+  Index_type m_size;
+
+  // Bitmap built from a list segment, shared between copies
+  std::shared_ptr<std::vector<uint64_t>> m_bit_data;
+
+  // Number of set bits before each word, shared between copies
+  std::shared_ptr<std::vector<Index_type>> m_ranks;
+};
+
+template <typename StorageT>
+constexpr Index_type TypedBitmaskSegment<StorageT>::bits_per_word;
+
+//! Alias for A TypedBitmaskSegment<Index_type>
+using BitmaskSegment = TypedBitmaskSegment<Index_type>;
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedBitmaskSegment
+template <typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedBitmaskSegment<StorageT>& a,
+                      RAJA::TypedBitmaskSegment<StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,651 @@
+/*!
+ ******************************************************************************
+ *
+ * \file BoxSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA multi-dimensional box
+ *         segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BoxSegment_HPP
+#define RAJA_BoxSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Index of a point in a TypedBoxSegment, with one coordinate per
+ *        dimension.
+ */
+template <typename StorageT, size_t N>
+struct BoxIndex {
+  StorageT idx[N];
+
+  RAJA_HOST_DEVICE RAJA_INLINE StorageT& operator[](size_t d) { return idx[d]; }
+
+  RAJA_HOST_DEVICE RAJA_INLINE const StorageT& operator[](size_t d) const
+  {
+    return idx[d];
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE bool operator==(const BoxIndex& other) const
+  {
+    for (size_t d = 0; d < N; ++d) {
+      if (idx[d] != other.idx[d]) return false;
+    }
+    return true;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE bool operator!=(const BoxIndex& other) const
+  {
+    return !(*this == other);
+  }
+};
+
+/*!
+ * \brief Traversal orders of a TypedBoxSegment.
+ */
+namespace box_order
+{
+
+//! Last dimension fastest, as in a RAJA::Layout with the default permutation
+struct row_major {
+};
+
+//! Row-major over tiles of TileSize points per dimension, row-major in tiles
+template <Index_type TileSize>
+struct tiled {
+  static_assert(TileSize > 0, "box_order::tiled requires TileSize > 0");
+};
+
+//! Morton (Z-order) space-filling curve
+struct morton {
+};
+
+//! Hilbert space-filling curve; consecutive points are neighbors only when
+//! the box is a cube whose side is a power of two, since points of the
+//! enclosing cube outside the box are skipped
+struct hilbert {
+};
+
+}  // namespace box_order
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedBoxSegment
+ *
+ * \brief  Segment class representing the points of an N-dimensional box.
+ *
+ * \tparam StorageT underlying data type for the point coordinates (required)
+ * \tparam N number of dimensions (required)
+ * \tparam Order traversal order from RAJA::box_order (row_major by default)
+ *
+ * The box is the product of the half-open intervals [lower[d], upper[d]).
+ * A box with upper[d] <= lower[d] in any dimension is empty.
+ *
+ * A TypedBoxSegment models an Iterable interface:
+ *
+ *  begin() -- returns a random access iterator over the points
+ *  end() -- returns a random access iterator over the points
+ *  size() -- returns number of points (RAJA::Index_type)
+ *
+ * The iterator visits the points in row-major order. The seq, loop, simd
+ * and OpenMP forall policies visit them in the segment traversal order
+ * instead, and the OpenMP policies split the box into compact sub-boxes,
+ * which they assign to threads. The Morton and Hilbert orders visit every
+ * aligned power-of-two sub-cube of the box before leaving it, so points
+ * that are near each other in space are visited at nearby times.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * TypedBoxSegment<int, 3, box_order::hilbert> box({{0, 0, 0}},
+ *                                                 {{nx, ny, nz}});
+ *
+ * forall<exec_pol>(box, [=] (BoxIndex<int, 3> p) {
+ *   // loop body -- use p[0], p[1], p[2] as index values
+ * });
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT,
+          size_t N,
+          typename Order = box_order::row_major>
+class TypedBoxSegment
+{
+  static_assert(N > 0 && N < 16,
+                "TypedBoxSegment supports 1 to 15 dimensions");
+
+public:
+  //@{
+  //!   @name Types used in implementation based on template parameters.
+
+  //! The type of the points of the box
+  using value_type = BoxIndex<StorageT, N>;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! The traversal order of the box
+  using order_type = Order;
+
+  //! Number of dimensions of the box
+  static constexpr size_t num_dims = N;
+
+  //@}
+
+  /*!
+   * \brief Random access iterator over the points in row-major order.
+   */
+  class iterator
+  {
+  public:
+    using value_type = BoxIndex<StorageT, N>;
+    using difference_type = Index_type;
+    using pointer = value_type*;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    RAJA_HOST_DEVICE iterator() : m_lower(), m_extent(), m_pos(0) {}
+
+    RAJA_HOST_DEVICE iterator(const value_type& lower,
+                              const Index_type (&extent)[N],
+                              Index_type pos)
+        : m_lower(lower), m_pos(pos)
+    {
+      for (size_t d = 0; d < N; ++d) {
+        m_extent[d] = extent[d];
+      }
+    }
+
+    RAJA_HOST_DEVICE value_type operator*() const { return point(m_pos); }
+
+    RAJA_HOST_DEVICE value_type operator[](difference_type n) const
+    {
+      return point(m_pos + n);
+    }
+
+    RAJA_HOST_DEVICE iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    RAJA_HOST_DEVICE iterator& operator+=(difference_type n)
+    {
+      m_pos += n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator-=(difference_type n)
+    {
+      m_pos -= n;
+      return *this;
+    }
+
+    RAJA_HOST_DEVICE iterator operator+(difference_type n) const
+    {
+      iterator tmp(*this);
+      tmp.m_pos += n;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE iterator operator-(difference_type n) const
+    {
+      iterator tmp(*this);
+      tmp.m_pos -= n;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE friend iterator operator+(difference_type n,
+                                               const iterator& it)
+    {
+      return it + n;
+    }
+    RAJA_HOST_DEVICE difference_type operator-(const iterator& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+    RAJA_HOST_DEVICE bool operator==(const iterator& rhs) const
+    {
+      return m_pos == rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator!=(const iterator& rhs) const
+    {
+      return m_pos != rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<(const iterator& rhs) const
+    {
+      return m_pos < rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>(const iterator& rhs) const
+    {
+      return m_pos > rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<=(const iterator& rhs) const
+    {
+      return m_pos <= rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>=(const iterator& rhs) const
+    {
+      return m_pos >= rhs.m_pos;
+    }
+
+  private:
+    RAJA_HOST_DEVICE value_type point(Index_type pos) const
+    {
+      value_type p;
+      for (size_t d = N; d-- > 0;) {
+        p[d] = static_cast<StorageT>(m_lower[d] + pos % m_extent[d]);
+        pos /= m_extent[d];
+      }
+      return p;
+    }
+
+    value_type m_lower;
+    Index_type m_extent[N];
+    Index_type m_pos;
+  };
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a box segment from its lower and upper bounds.
+   *
+   * \param lower first point of the box in each dimension
+   * \param upper one past the last point of the box in each dimension
+   */
+  TypedBoxSegment(const std::array<StorageT, N>& lower,
+                  const std::array<StorageT, N>& upper)
+  {
+    for (size_t d = 0; d < N; ++d) {
+      m_lower[d] = lower[d];
+      m_upper[d] = upper[d] < lower[d] ? lower[d] : upper[d];
+    }
+  }
+
+  //! Disable compiler generated constructor
+  TypedBoxSegment() = delete;
+
+  //! Copy constructor
+  TypedBoxSegment(const TypedBoxSegment&) = default;
+
+  //! Copy assignment
+  TypedBoxSegment& operator=(const TypedBoxSegment&) = default;
+
+  //! Box segment destructor
+  ~TypedBoxSegment() = default;
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  RAJA_HOST_DEVICE iterator begin() const
+  {
+    Index_type extent[N];
+    getExtents(extent);
+    return iterator(m_lower, extent, 0);
+  }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    Index_type extent[N];
+    getExtents(extent);
+    return iterator(m_lower, extent, size());
+  }
+
+  /*!
+   * \brief Get size of this segment (number of points)
+   */
+  RAJA_HOST_DEVICE Index_type size() const
+  {
+    Index_type len = 1;
+    for (size_t d = 0; d < N; ++d) {
+      len *= static_cast<Index_type>(m_upper[d] - m_lower[d]);
+    }
+    return len;
+  }
+
+  /*!
+   * \brief Get first point of the box in dimension d
+   */
+  RAJA_HOST_DEVICE StorageT getLower(size_t d) const { return m_lower[d]; }
+
+  /*!
+   * \brief Get one past the last point of the box in dimension d
+   */
+  RAJA_HOST_DEVICE StorageT getUpper(size_t d) const { return m_upper[d]; }
+
+  /*!
+   * \brief Get sub-box number piece of the 2^levels sub-boxes made by
+   *        repeatedly halving the longest dimension of the box.
+   *
+   * The sub-boxes partition the box. Each aligned block of 2^k consecutive
+   * pieces is a single box of the halving, so a contiguous range of pieces
+   * is made of a few such boxes, although consecutive pieces need not be
+   * neighbors. Some pieces are empty when the box has fewer than 2^levels
+   * points.
+   */
+  TypedBoxSegment getSubBox(Index_type piece, int levels) const
+  {
+    TypedBoxSegment sub(*this);
+    for (int level = levels - 1; level >= 0; --level) {
+      size_t dim = 0;
+      for (size_t d = 1; d < N; ++d) {
+        if (sub.m_upper[d] - sub.m_lower[d] >
+            sub.m_upper[dim] - sub.m_lower[dim]) {
+          dim = d;
+        }
+      }
+      const StorageT mid = static_cast<StorageT>(
+          sub.m_lower[dim] + (sub.m_upper[dim] - sub.m_lower[dim]) / 2);
+      if ((piece >> level) & 1) {
+        sub.m_lower[dim] = mid;
+      } else {
+        sub.m_upper[dim] = mid;
+      }
+    }
+    return sub;
+  }
+
+  /*!
+   * \brief Call body with each point of the box, in the traversal order
+   */
+  template <typename Func>
+  void visit(Func&& body) const
+  {
+    if (size() > 0) {
+      visitOrder(Order{}, body);
+    }
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if both segments hold the same points, else false
+   */
+  RAJA_HOST_DEVICE bool operator==(const TypedBoxSegment& other) const
+  {
+    if (size() == 0 || other.size() == 0) {
+      return size() == other.size();
+    }
+    return m_lower == other.m_lower && m_upper == other.m_upper;
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   */
+  RAJA_HOST_DEVICE bool operator!=(const TypedBoxSegment& other) const
+  {
+    return !(*this == other);
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  RAJA_HOST_DEVICE void swap(TypedBoxSegment& other)
+  {
+    camp::safe_swap(m_lower, other.m_lower);
+    camp::safe_swap(m_upper, other.m_upper);
+  }
+
+private:
+  RAJA_HOST_DEVICE void getExtents(Index_type (&extent)[N]) const
+  {
+    for (size_t d = 0; d < N; ++d) {
+      extent[d] = static_cast<Index_type>(m_upper[d] - m_lower[d]);
+    }
+  }
+
+  //
+  // Row-major traversal of the points of [lower, upper), which is not empty
+  //
+  template <typename Func>
+  static void visitRowMajor(const value_type& lower,
+                            const value_type& upper,
+                            Func& body)
+  {
+    value_type p = lower;
+    for (;;) {
+      for (p[N - 1] = lower[N - 1]; p[N - 1] < upper[N - 1]; ++p[N - 1]) {
+        body(p);
+      }
+      size_t d = N - 1;
+      while (d > 0) {
+        --d;
+        if (++p[d] < upper[d]) break;
+        p[d] = lower[d];
+        if (d == 0) return;
+      }
+      if (N == 1) return;
+    }
+  }
+
+  template <typename Func>
+  void visitOrder(box_order::row_major, Func& body) const
+  {
+    visitRowMajor(m_lower, m_upper, body);
+  }
+
+  template <Index_type TileSize, typename Func>
+  void visitOrder(box_order::tiled<TileSize>, Func& body) const
+  {
+    value_type tile_lower = m_lower;
+    value_type tile_upper;
+    for (;;) {
+      for (size_t d = 0; d < N; ++d) {
+        tile_upper[d] = (m_upper[d] - tile_lower[d] > TileSize)
+                            ? static_cast<StorageT>(tile_lower[d] + TileSize)
+                            : m_upper[d];
+      }
+      visitRowMajor(tile_lower, tile_upper, body);
+
+      size_t d = N;
+      while (d > 0) {
+        --d;
+        if (m_upper[d] - tile_lower[d] > TileSize) {
+          tile_lower[d] = static_cast<StorageT>(tile_lower[d] + TileSize);
+          break;
+        }
+        tile_lower[d] = m_lower[d];
+        if (d == 0) return;
+      }
+    }
+  }
+
+  template <typename Func>
+  void visitOrder(box_order::morton, Func& body) const
+  {
+    visitCurve<false>(body);
+  }
+
+  template <typename Func>
+  void visitOrder(box_order::hilbert, Func& body) const
+  {
+    visitCurve<true>(body);
+  }
+
+  //
+  // Visit the points of the box along a curve through the smallest
+  // power-of-two cube at m_lower that holds the box. The cube is divided
+  // recursively into 2^N sub-cubes, and sub-cubes outside the box are
+  // skipped, so the traversal does no work for points outside the box.
+  //
+  template <bool Hilbert, typename Func>
+  void visitCurve(Func& body) const
+  {
+    Index_type side = 1;
+    for (size_t d = 0; d < N; ++d) {
+      while (side < static_cast<Index_type>(m_upper[d] - m_lower[d])) {
+        side *= 2;
+      }
+    }
+    Index_type origin[N];
+    for (size_t d = 0; d < N; ++d) {
+      origin[d] = 0;
+    }
+    visitCube<Hilbert>(origin, side, 0, 0, body);
+  }
+
+  //
+  // Rotation of the low N bits of a word, for the Hilbert curve
+  //
+  static unsigned rotateLeft(unsigned bits, unsigned r)
+  {
+    r %= N;
+    const unsigned mask = (1u << N) - 1;
+    return ((bits << r) | (bits >> (N - r))) & mask;
+  }
+
+  //
+  // Visit the cube of the given side at origin, relative to m_lower. Bit j
+  // of a sub-cube label selects the upper half of dimension N - 1 - j.
+  //
+  // Hilbert sub-cubes are visited in Gray code order, transformed by the
+  // entry corner and direction of the cube as in C. H. Hamilton, "Compact
+  // Hilbert Indices", Dalhousie University Technical Report CS-2006-07.
+  //
+  template <bool Hilbert, typename Func>
+  void visitCube(const Index_type (&origin)[N],
+                 Index_type side,
+                 unsigned entry,
+                 unsigned dir,
+                 Func& body) const
+  {
+    for (size_t d = 0; d < N; ++d) {
+      if (origin[d] >= static_cast<Index_type>(m_upper[d] - m_lower[d])) {
+        return;
+      }
+    }
+
+    if (side == 1) {
+      value_type p;
+      for (size_t d = 0; d < N; ++d) {
+        p[d] = static_cast<StorageT>(m_lower[d] + origin[d]);
+      }
+      body(p);
+      return;
+    }
+
+    const Index_type half = side / 2;
+    for (unsigned i = 0; i < (1u << N); ++i) {
+      const unsigned gray = i ^ (i >> 1);
+      const unsigned label =
+          Hilbert ? (rotateLeft(gray, dir + 1) ^ entry) : i;
+
+      Index_type child[N];
+      for (size_t d = 0; d < N; ++d) {
+        child[d] = origin[d] + (((label >> (N - 1 - d)) & 1) ? half : 0);
+      }
+
+      unsigned child_entry = 0;
+      unsigned child_dir = 0;
+      if (Hilbert) {
+        // entry corner and direction of sub-cube i
+        unsigned e = 0;
+        unsigned dd = 0;
+        if (i > 0) {
+          const unsigned j = 2 * ((i - 1) / 2);
+          e = j ^ (j >> 1);
+          dd = trailingOnes((i % 2 == 0) ? i - 1 : i) % N;
+        }
+        child_entry = entry ^ rotateLeft(e, dir + 1);
+        child_dir = (dir + dd + 1) % N;
+      }
+
+      visitCube<Hilbert>(child, half, child_entry, child_dir, body);
+    }
+  }
+
+  static unsigned trailingOnes(unsigned bits)
+  {
+    unsigned count = 0;
+    while (bits & 1) {
+      bits >>= 1;
+      ++count;
+    }
+    return count;
+  }
+
+  // First point of the box in each dimension
+  value_type m_lower;
+
+  // One past the last point of the box in each dimension
+  value_type m_upper;
+};
+
+template <typename StorageT, size_t N, typename Order>
+constexpr size_t TypedBoxSegment<StorageT, N, Order>::num_dims;
+
+//! Alias for A TypedBoxSegment with RAJA::Index_type coordinates
+template <size_t N, typename Order = box_order::row_major>
+using BoxSegment = TypedBoxSegment<Index_type, N, Order>;
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedBoxSegment
+template <typename StorageT, size_t N, typename Order>
+RAJA_INLINE void swap(RAJA::TypedBoxSegment<StorageT, N, Order>& a,
+                      RAJA::TypedBoxSegment<StorageT, N, Order>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
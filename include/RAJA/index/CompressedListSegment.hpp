@@ -0,0 +1,554 @@
+/*!
+ ******************************************************************************
+ *
+ * \file CompressedListSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA compressed list segment
+ *         class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_CompressedListSegment_HPP
+#define RAJA_CompressedListSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedCompressedListSegment
+ *
+ * \brief  Segment class representing an arbitrary collection of indices,
+ *         stored bit-packed in blocks.
+ *
+ * \tparam StorageT integral data type of the segment indices (required)
+ *
+ * The indices are split into blocks of block_size indices. Each block
+ * stores its smallest index and the difference of every index from it,
+ * packed with the fewest bits that hold the largest difference in the
+ * block. Sorted or nearly sorted lists of indices that are close together
+ * need only a few bits per index, instead of sizeof(StorageT) bytes.
+ *
+ * A TypedCompressedListSegment models an Iterable interface:
+ *
+ *  begin() -- returns a random access iterator that decodes indices
+ *  end() -- returns a random access iterator that decodes indices
+ *  size() -- returns size of the Segment iteration space (RAJA::Index_type)
+ *
+ * The seq, loop, simd and OpenMP forall policies decode the segment one
+ * block at a time into a local array and run the loop body over that array.
+ * Other policies decode each index through the iterator.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * camp::resources::Resource resource{ camp resource type };
+ * TypedCompressedListSegment<T> seg(indices, length, resource);
+ *
+ * forall<exec_pol>(seg, [=] (T i) {
+ *   // loop body -- use i as index value
+ * });
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT>
+class TypedCompressedListSegment
+{
+  static_assert(std::is_integral<StorageT>::value,
+                "TypedCompressedListSegment requires an integral index type");
+
+  using unsigned_type = typename std::make_unsigned<StorageT>::type;
+
+public:
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Number of indices in each block
+  static constexpr Index_type block_size = 128;
+
+  //! Header of one block of packed indices
+  struct Block {
+    //! Smallest index in the block
+    value_type base;
+    //! Offset of the block's first packed word
+    Index_type word_offset;
+    //! Number of bits of each packed index
+    int width;
+  };
+
+  //@}
+
+  /*!
+   * \brief Random access iterator decoding the indices of the segment.
+   */
+  class iterator
+  {
+  public:
+    using value_type = StorageT;
+    using difference_type = Index_type;
+    using pointer = value_type*;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    RAJA_HOST_DEVICE constexpr iterator() : m_blocks(nullptr), m_words(nullptr), m_pos(0) {}
+
+    RAJA_HOST_DEVICE constexpr iterator(const Block* blocks,
+                                        const uint64_t* words,
+                                        Index_type pos)
+        : m_blocks(blocks), m_words(words), m_pos(pos)
+    {
+    }
+
+    RAJA_HOST_DEVICE value_type operator*() const
+    {
+      const Block& block = m_blocks[m_pos / block_size];
+      return decode(block, m_words + block.word_offset, m_pos % block_size);
+    }
+
+    RAJA_HOST_DEVICE value_type operator[](difference_type n) const
+    {
+      return *(*this + n);
+    }
+
+    RAJA_HOST_DEVICE iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    RAJA_HOST_DEVICE iterator& operator+=(difference_type n)
+    {
+      m_pos += n;
+      return *this;
+    }
+    RAJA_HOST_DEVICE iterator& operator-=(difference_type n)
+    {
+      m_pos -= n;
+      return *this;
+    }
+
+    RAJA_HOST_DEVICE iterator operator+(difference_type n) const
+    {
+      return iterator(m_blocks, m_words, m_pos + n);
+    }
+    RAJA_HOST_DEVICE iterator operator-(difference_type n) const
+    {
+      return iterator(m_blocks, m_words, m_pos - n);
+    }
+    RAJA_HOST_DEVICE friend iterator operator+(difference_type n,
+                                               const iterator& it)
+    {
+      return it + n;
+    }
+    RAJA_HOST_DEVICE difference_type operator-(const iterator& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+    RAJA_HOST_DEVICE bool operator==(const iterator& rhs) const
+    {
+      return m_pos == rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator!=(const iterator& rhs) const
+    {
+      return m_pos != rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<(const iterator& rhs) const
+    {
+      return m_pos < rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>(const iterator& rhs) const
+    {
+      return m_pos > rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator<=(const iterator& rhs) const
+    {
+      return m_pos <= rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE bool operator>=(const iterator& rhs) const
+    {
+      return m_pos >= rhs.m_pos;
+    }
+
+  private:
+    const Block* m_blocks;
+    const uint64_t* m_words;
+    Index_type m_pos;
+  };
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a compressed list segment from given array with
+   *        specified length and use given camp resource to allocate the
+   *        packed index data.
+   *
+   * \param values array of indices defining iteration space of segment
+   * \param length number of indices
+   * \param resource camp resource defining memory space where index data live
+   *
+   * The indices are packed on the host, so the given array must live in
+   * host memory space.
+   */
+  TypedCompressedListSegment(const value_type* values,
+                             Index_type length,
+                             camp::resources::Resource resource)
+      : m_resource(resource), m_blocks(nullptr), m_words(nullptr),
+        m_size(0), m_num_words(0)
+  {
+    initIndexData(values, length);
+  }
+
+  /*!
+   * \brief Construct a compressed list segment from given container of
+   *        indices.
+   *
+   * \param container container of indices for segment
+   * \param resource camp resource defining memory space where index data live
+   *
+   * The given container must provide methods begin(), end(), and size().
+   * Constructor assumes container data lives in host memory space.
+   */
+  template <typename Container>
+  TypedCompressedListSegment(const Container& container,
+                             camp::resources::Resource resource)
+      : m_resource(resource), m_blocks(nullptr), m_words(nullptr),
+        m_size(0), m_num_words(0)
+  {
+    std::vector<value_type> values(container.begin(), container.end());
+    initIndexData(values.data(), static_cast<Index_type>(values.size()));
+  }
+
+  //! Disable compiler generated constructor
+  TypedCompressedListSegment() = delete;
+
+  //! Copy constructor, sharing the packed index data
+  TypedCompressedListSegment(const TypedCompressedListSegment&) = default;
+
+  //! Move constructor
+  TypedCompressedListSegment(TypedCompressedListSegment&&) = default;
+
+  //! Compressed list segment destructor
+  ~TypedCompressedListSegment() = default;
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  RAJA_HOST_DEVICE iterator begin() const
+  {
+    return iterator(m_blocks, m_words, 0);
+  }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(m_blocks, m_words, m_size);
+  }
+
+  /*!
+   * \brief Get size of this segment (number of indices)
+   */
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  /*!
+   * \brief Get number of blocks of packed indices
+   */
+  RAJA_HOST_DEVICE Index_type getNumBlocks() const
+  {
+    return (m_size + block_size - 1) / block_size;
+  }
+
+  /*!
+   * \brief Get number of bytes of packed index data and block headers
+   */
+  RAJA_HOST_DEVICE size_t getCompressedBytes() const
+  {
+    return getNumBlocks() * sizeof(Block) + m_num_words * sizeof(uint64_t);
+  }
+
+  /*!
+   * \brief Decode the indices of a block
+   *
+   * \param block_id id of the block, in [0, getNumBlocks())
+   * \param out array of at least block_size values receiving the indices
+   *
+   * \return number of indices in the block
+   */
+  RAJA_HOST_DEVICE Index_type decodeBlock(Index_type block_id,
+                                          value_type* out) const
+  {
+    const Block& block = m_blocks[block_id];
+    const uint64_t* words = m_words + block.word_offset;
+    Index_type len = m_size - block_id * block_size;
+    len = len < block_size ? len : block_size;
+
+    for (Index_type i = 0; i < len; ++i) {
+      out[i] = decode(block, words, i);
+    }
+    return len;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment's indices to an array of values
+   *
+   * Method assumes values in given array and segment indices both live in
+   * host memory space.
+   */
+  bool indicesEqual(const value_type* container, Index_type len) const
+  {
+    if (len != m_size) return false;
+    value_type block[block_size];
+    for (Index_type b = 0; b < getNumBlocks(); ++b) {
+      Index_type num = decodeBlock(b, block);
+      for (Index_type i = 0; i < num; ++i) {
+        if (block[i] != container[b * block_size + i]) return false;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * Method assumes indices in both segments live in host memory space.
+   */
+  bool operator==(const TypedCompressedListSegment& other) const
+  {
+    if (m_size != other.m_size) return false;
+    value_type block[block_size];
+    for (Index_type b = 0; b < getNumBlocks(); ++b) {
+      Index_type num = other.decodeBlock(b, block);
+      for (Index_type i = 0; i < num; ++i) {
+        if (block[i] != begin()[b * block_size + i]) return false;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   */
+  bool operator!=(const TypedCompressedListSegment& other) const
+  {
+    return !(*this == other);
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  void swap(TypedCompressedListSegment& other)
+  {
+    camp::safe_swap(m_resource, other.m_resource);
+    camp::safe_swap(m_blocks, other.m_blocks);
+    camp::safe_swap(m_words, other.m_words);
+    camp::safe_swap(m_size, other.m_size);
+    camp::safe_swap(m_num_words, other.m_num_words);
+    camp::safe_swap(m_block_data, other.m_block_data);
+    camp::safe_swap(m_word_data, other.m_word_data);
+  }
+
+private:
+  //
+  // Decode index i of a block whose packed words start at words. Reads the
+  // word after the one holding the index, which the encoder always provides.
+  // The second shift is split so that it is well defined for shift == 0.
+  //
+  RAJA_HOST_DEVICE RAJA_INLINE static value_type decode(const Block& block,
+                                                        const uint64_t* words,
+                                                        Index_type i)
+  {
+    const uint64_t bit = static_cast<uint64_t>(i) * block.width;
+    const uint64_t word = bit >> 6;
+    const unsigned shift = bit & 63;
+    const uint64_t mask =
+        block.width == 64 ? ~uint64_t(0) : (uint64_t(1) << block.width) - 1;
+
+    uint64_t packed = (words[word] >> shift) |
+                      ((words[word + 1] << 1) << (63 - shift));
+
+    return static_cast<value_type>(static_cast<unsigned_type>(block.base) +
+                                   static_cast<unsigned_type>(packed & mask));
+  }
+
+  static int bitWidth(uint64_t range)
+  {
+    int width = 0;
+    while (range != 0) {
+      ++width;
+      range >>= 1;
+    }
+    return width;
+  }
+
+  //
+  // Pack the indices on the host and copy them to the memory space of the
+  // resource.
+  //
+  void initIndexData(const value_type* values, Index_type len)
+  {
+    if (len <= 0 || values == nullptr) {
+      return;
+    }
+
+    m_size = len;
+    const Index_type num_blocks = getNumBlocks();
+
+    std::vector<Block> blocks(num_blocks);
+    std::vector<uint64_t> words;
+
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      const value_type* block_values = values + b * block_size;
+      Index_type num = m_size - b * block_size;
+      num = num < block_size ? num : block_size;
+
+      value_type lo = block_values[0];
+      value_type hi = block_values[0];
+      for (Index_type i = 1; i < num; ++i) {
+        lo = block_values[i] < lo ? block_values[i] : lo;
+        hi = block_values[i] > hi ? block_values[i] : hi;
+      }
+
+      Block& block = blocks[b];
+      block.base = lo;
+      block.word_offset = static_cast<Index_type>(words.size());
+      block.width = bitWidth(static_cast<unsigned_type>(hi) -
+                             static_cast<unsigned_type>(lo));
+
+      if (block.width == 0) {
+        continue;
+      }
+
+      words.resize(words.size() + (num * block.width + 63) / 64, 0);
+      uint64_t* block_words = words.data() + block.word_offset;
+      for (Index_type i = 0; i < num; ++i) {
+        uint64_t packed = static_cast<unsigned_type>(block_values[i]) -
+                          static_cast<unsigned_type>(lo);
+        uint64_t bit = static_cast<uint64_t>(i) * block.width;
+        unsigned shift = bit & 63;
+        block_words[bit >> 6] |= packed << shift;
+        if (shift + block.width > 64) {
+          block_words[(bit >> 6) + 1] |= packed >> (64 - shift);
+        }
+      }
+    }
+
+    // decode reads two words at the offset of a block, even if it has none
+    words.resize(words.size() + 2, 0);
+    m_num_words = static_cast<Index_type>(words.size());
+
+    m_blocks = allocate(m_block_data, blocks.data(), num_blocks);
+    m_words = allocate(m_word_data, words.data(), m_num_words);
+  }
+
+  template <typename T>
+  T* allocate(std::shared_ptr<T>& holder, const T* host_data, Index_type num)
+  {
+    T* ptr = m_resource.allocate<T>(num);
+    camp::resources::Resource resource = m_resource;
+    holder = std::shared_ptr<T>(ptr, [resource](T* p) mutable {
+      resource.deallocate(p);
+    });
+    m_resource.memcpy(ptr, host_data, sizeof(T) * num);
+    return ptr;
+  }
+
+  // Copy of camp resource passed to ctor
+  camp::resources::Resource m_resource;
+
+  // Block headers and packed indices
+  Block* m_blocks;
+  uint64_t* m_words;
+
+  // Size of segment
+  Index_type m_size;
+
+  // Number of packed words, including padding
+  Index_type m_num_words;
+
+  // Packed data shared between copies of this segment
+  std::shared_ptr<Block> m_block_data;
+  std::shared_ptr<uint64_t> m_word_data;
+};
+
+template <typename StorageT>
+constexpr Index_type TypedCompressedListSegment<StorageT>::block_size;
+
+//! Alias for A TypedCompressedListSegment<Index_type>
+using CompressedListSegment = TypedCompressedListSegment<Index_type>;
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedCompressedListSegment
+template <typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedCompressedListSegment<StorageT>& a,
+                      RAJA::TypedCompressedListSegment<StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
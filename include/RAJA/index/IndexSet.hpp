@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
@@ -312,15 +314,7 @@ public:
   }
 
   //! Return total length -- sum of lengths of all segments
-  RAJA_INLINE size_t getLength() const
-  {
-    size_t total = PARENT::getLength();
-    size_t num = data.size();
-    for (size_t i = 0; i < num; ++i) {
-      total += data[i]->size();
-    }
-    return total;
-  }
+  RAJA_INLINE size_t getLength() const { return getTotalLength(); }
 
   //! Return total number of segments in index set.
   RAJA_INLINE constexpr size_t getNumSegments() const
@@ -404,6 +398,12 @@ protected:
   //! Returns the number of indices (the total icount of segments
   RAJA_INLINE Index_type &getTotalLength() { return PARENT::getTotalLength(); }
 
+  //! Returns the number of indices (the total icount of segments
+  RAJA_INLINE Index_type getTotalLength() const
+  {
+    return PARENT::getTotalLength();
+  }
+
   //! set total length of the indexset
   RAJA_INLINE void setTotalLength(int n) { return PARENT::setTotalLength(n); }
 
@@ -672,6 +672,8 @@ protected:
 
   RAJA_INLINE Index_type &getTotalLength() { return m_len; }
 
+  RAJA_INLINE Index_type getTotalLength() const { return m_len; }
+
   RAJA_INLINE void setTotalLength(int n) { m_len = n; }
 
   RAJA_INLINE void increaseTotalLength(int n) { m_len += n; }
@@ -732,6 +734,30 @@ public:
     return segment_icounts[segid];
   }
 
+  //! Return number of indices in segment, without visiting the segment
+  RAJA_INLINE Index_type getSegmentLength(size_t segid) const
+  {
+    Index_type next = segid + 1 < segment_icounts.size()
+                          ? segment_icounts[segid + 1]
+                          : m_len;
+    return next - segment_icounts[segid];
+  }
+
+  ///
+  /// Return id of first segment whose starting icount is not less than
+  /// the given icount, or the number of segments if there is none.
+  ///
+  /// Used to split the segments into contiguous blocks with about the same
+  /// number of indices.
+  ///
+  RAJA_INLINE size_t getSegmentAtIcount(Index_type icount) const
+  {
+    return std::lower_bound(segment_icounts.begin(),
+                            segment_icounts.end(),
+                            icount) -
+           segment_icounts.begin();
+  }
+
   //! Get an iterator to the end.
   iterator end() const { return iterator(getNumSegments()); }
 
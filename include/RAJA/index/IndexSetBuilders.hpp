@@ -61,6 +61,37 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
     RAJA::Index_type range_min_length,
     RAJA::Index_type range_align);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with one segment per part of a partition of
+ *        an index array. Parts whose indices are contiguous and increasing
+ *        become range segments; all others become list segments.
+ *
+ *        Segments are built in parallel when RAJA is built with OpenMP, and
+ *        the index set records each segment's length and starting icount as
+ *        segments are appended, so neither is recomputed when the index set
+ *        is traversed.
+ *
+ *  \param iset reference to index set generated. Method assumes index set
+ *         is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *  \param indices pointer to start of input array of indices.
+ *  \param part_offsets array of num_parts + 1 offsets into indices; part p
+ *         holds indices[part_offsets[p]] up to indices[part_offsets[p+1]].
+ *  \param num_parts number of parts, and of segments generated.
+ *
+ ******************************************************************************
+ */
+void RAJASHAREDDLL_API buildIndexSetPartitioned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices,
+    const RAJA::Index_type* const part_offsets,
+    RAJA::Index_type num_parts);
+
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -55,7 +56,11 @@ namespace RAJA
  *       memory space specified by the camp resource object and the values are
  *       copied from the input array to that. Ownership of the indices is 
  *       determined by an optional ownership enum value passed to the 
- *       constructor.
+ *       constructor. A segment constructed from a Span is a view of the
+ *       spanned indices and never copies them.
+ *
+ *       Copies of a segment share its index array, which is freed when the
+ *       last segment owning it is destroyed.
  *
  * Usage:
  *
@@ -145,56 +150,68 @@ public:
   {
     if (m_size > 0) {
 
-      camp::resources::Resource host_res{camp::resources::Host()};
+      allocateIndexData();
 
-      value_type* tmp = host_res.allocate<value_type>(m_size);
+      if (isHostResource()) {
 
-      auto dest = tmp;
-      auto src = container.begin();
-      auto const end = container.end();
-      while (src != end) {
-        *dest = *src;
-        ++dest;
-        ++src;
-      }
+        // fill the segment directly, without an intermediate copy
+        auto dest = m_data;
+        auto src = container.begin();
+        auto const end = container.end();
+        while (src != end) {
+          *dest = *src;
+          ++dest;
+          ++src;
+        }
 
-      m_data = m_resource.allocate<value_type>(m_size);
-      m_resource.memcpy(m_data, tmp, sizeof(value_type) * m_size);
-      m_owned = Owned;
+      } else {
 
-      host_res.deallocate(tmp);
+        copyContainer(container, has_contiguous_data<Container>{});
+
+      }
 
     }
   }
 
-  //! Disable compiler generated constructor
-  TypedListSegment() = delete;
-
-  //! Copy constructor for list segment
-  TypedListSegment(const TypedListSegment& other)
-    : m_resource(other.m_resource),
+  /*!
+   * \brief Construct a list segment that is a view of the indices in the
+   *        given span.
+   *
+   * \param indices span of indices defining iteration space of segment
+   *
+   * The segment does not own or copy the indices, which may live in any
+   * memory space. Caller must manage their lifetime properly.
+   */
+  template <typename IterType, typename IndexType>
+  explicit TypedListSegment(Span<IterType, IndexType> indices)
+    : m_resource(camp::resources::Host()),
       m_owned(Unowned), m_data(nullptr), m_size(0)
   {
-    bool from_copy_ctor = true;
-    initIndexData(other.m_data, other.m_size, other.m_owned, from_copy_ctor);
+    static_assert(std::is_convertible<IterType, const value_type*>::value,
+                  "ListSegment span must be over contiguous indices of the "
+                  "segment value_type");
+    initIndexData(indices.data(), static_cast<Index_type>(indices.size()),
+                  Unowned);
   }
 
+  //! Disable compiler generated constructor
+  TypedListSegment() = delete;
+
+  //! Copy constructor for list segment, sharing the index data
+  TypedListSegment(const TypedListSegment& other) = default;
+
   //! Move constructor for list segment
   TypedListSegment(TypedListSegment&& rhs)
     : m_resource(rhs.m_resource),
-      m_owned(rhs.m_owned), m_data(rhs.m_data), m_size(rhs.m_size)
+      m_owned(rhs.m_owned), m_data(rhs.m_data), m_size(rhs.m_size),
+      m_index_data(std::move(rhs.m_index_data))
   {
-    // make the rhs non-owning so it's destructor won't have any side effects
+    // make the rhs non-owning; it no longer shares the index data
     rhs.m_owned = Unowned;
   }
 
   //! List segment destructor
-  ~TypedListSegment()
-  {
-    if (m_data != nullptr && m_owned == Owned) {
-      m_resource.deallocate(m_data);
-    }
-  }
+  ~TypedListSegment() = default;
 
   //@}
 
@@ -286,16 +303,80 @@ public:
     camp::safe_swap(m_data, other.m_data);
     camp::safe_swap(m_size, other.m_size);
     camp::safe_swap(m_owned, other.m_owned);
+    camp::safe_swap(m_index_data, other.m_index_data);
   }
 
 private:
+  //
+  // Containers whose indices are contiguous and of the segment value_type
+  // can be copied to the segment memory space directly.
+  //
+  template <typename Container, typename = void>
+  struct has_contiguous_data : std::false_type {
+  };
+
+  template <typename Container>
+  struct has_contiguous_data<
+      Container,
+      typename std::enable_if<std::is_same<
+          camp::decay<decltype(*std::declval<const Container&>().data())>,
+          value_type>::value>::type> : std::true_type {
+  };
+
+  bool isHostResource() const
+  {
+    return m_resource.get_platform() == camp::resources::Platform::host;
+  }
+
+  //
+  // Allocate m_size indices in the memory space of the resource, shared by
+  // all copies of this segment and freed with the last of them.
+  //
+  void allocateIndexData()
+  {
+    m_data = m_resource.allocate<value_type>(m_size);
+    m_owned = Owned;
+
+    camp::resources::Resource resource = m_resource;
+    m_index_data = std::shared_ptr<value_type>(
+        m_data, [resource](value_type* ptr) mutable {
+          resource.deallocate(ptr);
+        });
+  }
+
+  template <typename Container>
+  void copyContainer(const Container& container, std::true_type)
+  {
+    m_resource.memcpy(m_data, container.data(), sizeof(value_type) * m_size);
+  }
+
+  template <typename Container>
+  void copyContainer(const Container& container, std::false_type)
+  {
+    camp::resources::Resource host_res{camp::resources::Host()};
+
+    value_type* tmp = host_res.allocate<value_type>(m_size);
+
+    auto dest = tmp;
+    auto src = container.begin();
+    auto const end = container.end();
+    while (src != end) {
+      *dest = *src;
+      ++dest;
+      ++src;
+    }
+
+    m_resource.memcpy(m_data, tmp, sizeof(value_type) * m_size);
+
+    host_res.deallocate(tmp);
+  }
+
   //
   // Initialize segment data based on whether object owns the index data.
   //
   void initIndexData(const value_type* container,
                      Index_type len,
-                     IndexOwnership container_own,
-                     bool from_copy_ctor = false)
+                     IndexOwnership container_own)
   {
 
     // empty list segment
@@ -311,26 +392,12 @@ private:
     m_owned = container_own;
     if (m_owned == Owned) {
 
-      if ( from_copy_ctor ) {
-
-        m_data = m_resource.allocate<value_type>(m_size);
-        m_resource.memcpy(m_data, container, sizeof(value_type) * m_size); 
+      allocateIndexData();
 
+      if (isHostResource()) {
+        std::copy(container, container + m_size, m_data);
       } else {
-
-        camp::resources::Resource host_res{camp::resources::Host()};
-
-        value_type* tmp = host_res.allocate<value_type>(m_size);
-
-        for (Index_type i = 0; i < m_size; ++i) {
-          tmp[i] = container[i];
-        }
-
-        m_data = m_resource.allocate<value_type>(m_size);
-        m_resource.memcpy(m_data, tmp, sizeof(value_type) * m_size);
-
-        host_res.deallocate(tmp);
-
+        m_resource.memcpy(m_data, container, sizeof(value_type) * m_size);
       }
 
       return;
@@ -353,6 +420,9 @@ private:
 
   // Size of list segment
   Index_type m_size;
+
+  // Owned index data shared between copies of this segment
+  std::shared_ptr<value_type> m_index_data;
 };
 
 //! Alias for A TypedListSegment<Index_type>
@@ -22,6 +22,8 @@
 
 #include "RAJA/policy/atomic_auto.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_combining.hpp"
+#include "RAJA/policy/atomic_order.hpp"
 
 #include "RAJA/util/macros.hpp"
 
@@ -45,6 +47,19 @@ namespace RAJA
  * With the exception of the auto_atomic policy which then calls the
  * "appropriate" policy implementation.
  *
+ * Each operation also takes a memory order (RAJA::memory_order_relaxed,
+ * _acquire, _release, _acq_rel, _seq_cst or _default):
+ *
+ * T atomicAdd<Policy, Order>(T *acc, T value)
+ *
+ * calls
+ *
+ * T atomicAdd(Policy{}, Order{}, T *acc, T value)
+ *
+ * builtin_atomic and the DESUL backend map orders directly onto their
+ * instructions; other policies place fences around their relaxed operation.
+ * atomicLoad and atomicStore give ordered plain loads and stores.
+ *
  *
  * Current supported policies include:
  *
@@ -60,6 +75,12 @@ namespace RAJA
  *
  *   seq_atomic        -- Non-atomic, does an unprotected (raw) operation
  *
+ *   combining_atomic<Policy>
+ *                     -- Host only, combines updates to contended locations
+ *                        in per-thread slots and applies them with Policy
+ *                        when flushed; the deferred operations (add, sub,
+ *                        min, max, inc, dec) return void
+ *
  *
  * Current supported data types include:
  *
@@ -75,6 +96,7 @@ namespace RAJA
  * The implementation code lives in:
  * RAJA/policy/atomic_auto.hpp     -- for auto_atomic
  * RAJA/policy/atomic_builtin.hpp  -- for builtin_atomic
+ * RAJA/policy/atomic_combining.hpp -- for combining_atomic
  * RAJA/policy/XXX/atomic.hpp      -- for omp_atomic, cuda_atomic, etc.
  *
  */
@@ -88,7 +110,8 @@ namespace RAJA
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE detail::atomic_update_result_t<Policy, T>
+atomicAdd(T volatile *acc, T value)
 {
   return RAJA::atomicAdd(Policy{}, acc, value);
 }
@@ -102,7 +125,8 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicSub(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE detail::atomic_update_result_t<Policy, T>
+atomicSub(T volatile *acc, T value)
 {
   return RAJA::atomicSub(Policy{}, acc, value);
 }
@@ -116,7 +140,8 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicSub(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicMin(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE detail::atomic_update_result_t<Policy, T>
+atomicMin(T volatile *acc, T value)
 {
   return RAJA::atomicMin(Policy{}, acc, value);
 }
@@ -130,7 +155,8 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicMin(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicMax(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE detail::atomic_update_result_t<Policy, T>
+atomicMax(T volatile *acc, T value)
 {
   return RAJA::atomicMax(Policy{}, acc, value);
 }
@@ -143,7 +169,8 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicMax(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicInc(T volatile *acc)
+RAJA_INLINE RAJA_HOST_DEVICE detail::atomic_update_result_t<Policy, T>
+atomicInc(T volatile *acc)
 {
   return RAJA::atomicInc(Policy{}, acc);
 }
@@ -172,7 +199,8 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicInc(T volatile *acc, T compare)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicDec(T volatile *acc)
+RAJA_INLINE RAJA_HOST_DEVICE detail::atomic_update_result_t<Policy, T>
+atomicDec(T volatile *acc)
 {
   return RAJA::atomicDec(Policy{}, acc);
 }
@@ -274,6 +302,387 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicCAS(T volatile *acc, T compare, T value)
   return RAJA::atomicCAS(Policy{}, acc, compare, value);
 }
 
+#if !defined(RAJA_ENABLE_DESUL_ATOMICS)
+
+/*
+ * Ordered operations for atomic policies without an ordered implementation
+ * of their own: the policy's operation, made at least as strong as Order by
+ * the fences of detail::atomic_order_fence. memory_order_default adds none.
+ */
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicLoad(Policy, Order, T volatile *acc)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = *acc;
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, void>
+atomicStore(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  *acc = value;
+  detail::atomic_order_fence<Policy, Order>::after();
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicAdd(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicAdd(Policy{}, acc, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicSub(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicSub(Policy{}, acc, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicMin(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicMin(Policy{}, acc, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicMax(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicMax(Policy{}, acc, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicInc(Policy, Order, T volatile *acc)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicInc(Policy{}, acc);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicInc(Policy, Order, T volatile *acc, T compare)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicInc(Policy{}, acc, compare);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicDec(Policy, Order, T volatile *acc)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicDec(Policy{}, acc);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicDec(Policy, Order, T volatile *acc, T compare)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicDec(Policy{}, acc, compare);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicAnd(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicAnd(Policy{}, acc, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicOr(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicOr(Policy{}, acc, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicXor(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicXor(Policy{}, acc, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicExchange(Policy, Order, T volatile *acc, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicExchange(Policy{}, acc, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicCAS(Policy, Order, T volatile *acc, T compare, T value)
+{
+  detail::atomic_order_fence<Policy, Order>::before();
+  T ret = atomicCAS(Policy{}, acc, compare, value);
+  detail::atomic_order_fence<Policy, Order>::after();
+  return ret;
+}
+
+#endif  // RAJA_ENABLE_DESUL_ATOMICS
+
+
+/*!
+ * @brief Atomic load
+ * @param acc Pointer to location of value to load
+ * @return Returns value at acc
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order = memory_order_default, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicLoad(T volatile *acc)
+{
+  return RAJA::atomicLoad(Policy{}, Order{}, acc);
+}
+
+
+/*!
+ * @brief Atomic store
+ * @param acc Pointer to location to store value
+ * @param value Value to store to *acc
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order = memory_order_default, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE void atomicStore(T volatile *acc, T value)
+{
+  RAJA::atomicStore(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic add with memory order Order
+ * Same as atomicAdd<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE
+    detail::enable_if_memory_order<Order, detail::atomic_update_result_t<Policy, T>>
+atomicAdd(T volatile *acc, T value)
+{
+  return RAJA::atomicAdd(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic subtract with memory order Order
+ * Same as atomicSub<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE
+    detail::enable_if_memory_order<Order, detail::atomic_update_result_t<Policy, T>>
+atomicSub(T volatile *acc, T value)
+{
+  return RAJA::atomicSub(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic minimum with memory order Order
+ * Same as atomicMin<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE
+    detail::enable_if_memory_order<Order, detail::atomic_update_result_t<Policy, T>>
+atomicMin(T volatile *acc, T value)
+{
+  return RAJA::atomicMin(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic maximum with memory order Order
+ * Same as atomicMax<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE
+    detail::enable_if_memory_order<Order, detail::atomic_update_result_t<Policy, T>>
+atomicMax(T volatile *acc, T value)
+{
+  return RAJA::atomicMax(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic increment with memory order Order
+ * Same as atomicInc<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE
+    detail::enable_if_memory_order<Order, detail::atomic_update_result_t<Policy, T>>
+atomicInc(T volatile *acc)
+{
+  return RAJA::atomicInc(Policy{}, Order{}, acc);
+}
+
+
+/*!
+ * @brief Atomic increment with bound with memory order Order
+ * Same as atomicInc<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicInc(T volatile *acc, T compare)
+{
+  return RAJA::atomicInc(Policy{}, Order{}, acc, compare);
+}
+
+
+/*!
+ * @brief Atomic decrement with memory order Order
+ * Same as atomicDec<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE
+    detail::enable_if_memory_order<Order, detail::atomic_update_result_t<Policy, T>>
+atomicDec(T volatile *acc)
+{
+  return RAJA::atomicDec(Policy{}, Order{}, acc);
+}
+
+
+/*!
+ * @brief Atomic decrement with bound with memory order Order
+ * Same as atomicDec<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicDec(T volatile *acc, T compare)
+{
+  return RAJA::atomicDec(Policy{}, Order{}, acc, compare);
+}
+
+
+/*!
+ * @brief Atomic bitwise AND with memory order Order
+ * Same as atomicAnd<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicAnd(T volatile *acc, T value)
+{
+  static_assert(std::is_integral<T>::value,
+                "atomicAnd can only be used on integral types");
+  return RAJA::atomicAnd(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic bitwise OR with memory order Order
+ * Same as atomicOr<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicOr(T volatile *acc, T value)
+{
+  static_assert(std::is_integral<T>::value,
+                "atomicOr can only be used on integral types");
+  return RAJA::atomicOr(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic bitwise XOR with memory order Order
+ * Same as atomicXor<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicXor(T volatile *acc, T value)
+{
+  static_assert(std::is_integral<T>::value,
+                "atomicXor can only be used on integral types");
+  return RAJA::atomicXor(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic value exchange with memory order Order
+ * Same as atomicExchange<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicExchange(T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(Policy{}, Order{}, acc, value);
+}
+
+
+/*!
+ * @brief Atomic compare and swap with memory order Order
+ * Same as atomicCAS<Policy>, with the ordering of the matching std::memory_order.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE detail::enable_if_memory_order<Order, T>
+atomicCAS(T volatile *acc, T compare, T value)
+{
+  return RAJA::atomicCAS(Policy{}, Order{}, acc, compare, value);
+}
+
 /*!
  * \brief Atomic wrapper object
  *
@@ -281,9 +690,12 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicCAS(T volatile *acc, T compare, T value)
  * arbitrary memory location.
  *
  * This object provides an OO interface to the global function calls provided
- * as RAJA::atomicXXX
+ * as RAJA::atomicXXX. Every operation, including loads and stores, uses
+ * MemoryOrder; the default keeps the ordering of the atomic policy.
  */
-template <typename T, typename Policy = auto_atomic>
+template <typename T,
+          typename Policy = auto_atomic,
+          typename MemoryOrder = memory_order_default>
 class AtomicRef
 {
 public:
@@ -309,14 +721,14 @@ public:
   RAJA_HOST_DEVICE
   void store(value_type rhs) const
   {
-    *m_value_ptr = rhs;
+    RAJA::atomicStore<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator=(value_type rhs) const
   {
-    *m_value_ptr = rhs;
+    RAJA::atomicStore<Policy, MemoryOrder>(m_value_ptr, rhs);
     return rhs;
   }
 
@@ -324,28 +736,28 @@ public:
   RAJA_HOST_DEVICE
   value_type load() const
   {
-    return *m_value_ptr;
+    return RAJA::atomicLoad<Policy, MemoryOrder>(m_value_ptr);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   operator value_type() const
   {
-    return *m_value_ptr;
+    return RAJA::atomicLoad<Policy, MemoryOrder>(m_value_ptr);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type exchange(value_type rhs) const
   {
-    return RAJA::atomicExchange<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicExchange<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type CAS(value_type compare, value_type rhs) const
   {
-    return RAJA::atomicCAS<Policy>(m_value_ptr, compare, rhs);
+    return RAJA::atomicCAS<Policy, MemoryOrder>(m_value_ptr, compare, rhs);
   }
 
   RAJA_INLINE
@@ -353,7 +765,7 @@ public:
   bool compare_exchange_strong(value_type& expect, value_type rhs) const
   {
     value_type compare = expect;
-    value_type old = RAJA::atomicCAS<Policy>(m_value_ptr, compare, rhs);
+    value_type old = RAJA::atomicCAS<Policy, MemoryOrder>(m_value_ptr, compare, rhs);
     if (compare == old) {
       return true;
     } else {
@@ -373,70 +785,70 @@ public:
   RAJA_HOST_DEVICE
   value_type operator++() const
   {
-    return RAJA::atomicInc<Policy>(m_value_ptr) + 1;
+    return RAJA::atomicInc<Policy, MemoryOrder>(m_value_ptr) + 1;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator++(int) const
   {
-    return RAJA::atomicInc<Policy>(m_value_ptr);
+    return RAJA::atomicInc<Policy, MemoryOrder>(m_value_ptr);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator--() const
   {
-    return RAJA::atomicDec<Policy>(m_value_ptr) - 1;
+    return RAJA::atomicDec<Policy, MemoryOrder>(m_value_ptr) - 1;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator--(int) const
   {
-    return RAJA::atomicDec<Policy>(m_value_ptr);
+    return RAJA::atomicDec<Policy, MemoryOrder>(m_value_ptr);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_add(value_type rhs) const
   {
-    return RAJA::atomicAdd<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicAdd<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator+=(value_type rhs) const
   {
-    return RAJA::atomicAdd<Policy>(m_value_ptr, rhs) + rhs;
+    return RAJA::atomicAdd<Policy, MemoryOrder>(m_value_ptr, rhs) + rhs;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_sub(value_type rhs) const
   {
-    return RAJA::atomicSub<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicSub<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator-=(value_type rhs) const
   {
-    return RAJA::atomicSub<Policy>(m_value_ptr, rhs) - rhs;
+    return RAJA::atomicSub<Policy, MemoryOrder>(m_value_ptr, rhs) - rhs;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_min(value_type rhs) const
   {
-    return RAJA::atomicMin<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicMin<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type min(value_type rhs) const
   {
-    value_type old = RAJA::atomicMin<Policy>(m_value_ptr, rhs);
+    value_type old = RAJA::atomicMin<Policy, MemoryOrder>(m_value_ptr, rhs);
     return old < rhs ? old : rhs;
   }
 
@@ -444,14 +856,14 @@ public:
   RAJA_HOST_DEVICE
   value_type fetch_max(value_type rhs) const
   {
-    return RAJA::atomicMax<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicMax<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type max(value_type rhs) const
   {
-    value_type old = RAJA::atomicMax<Policy>(m_value_ptr, rhs);
+    value_type old = RAJA::atomicMax<Policy, MemoryOrder>(m_value_ptr, rhs);
     return old > rhs ? old : rhs;
   }
 
@@ -459,42 +871,216 @@ public:
   RAJA_HOST_DEVICE
   value_type fetch_and(value_type rhs) const
   {
-    return RAJA::atomicAnd<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicAnd<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator&=(value_type rhs) const
   {
-    return RAJA::atomicAnd<Policy>(m_value_ptr, rhs) & rhs;
+    return RAJA::atomicAnd<Policy, MemoryOrder>(m_value_ptr, rhs) & rhs;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_or(value_type rhs) const
   {
-    return RAJA::atomicOr<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicOr<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator|=(value_type rhs) const
   {
-    return RAJA::atomicOr<Policy>(m_value_ptr, rhs) | rhs;
+    return RAJA::atomicOr<Policy, MemoryOrder>(m_value_ptr, rhs) | rhs;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_xor(value_type rhs) const
   {
-    return RAJA::atomicXor<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicXor<Policy, MemoryOrder>(m_value_ptr, rhs);
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator^=(value_type rhs) const
   {
-    return RAJA::atomicXor<Policy>(m_value_ptr, rhs) ^ rhs;
+    return RAJA::atomicXor<Policy, MemoryOrder>(m_value_ptr, rhs) ^ rhs;
+  }
+
+private:
+  value_type volatile *m_value_ptr;
+};
+
+
+/*!
+ * \brief Atomic wrapper object for combining_atomic
+ *
+ * Same as AtomicRef, except that the updates combining_atomic defers return
+ * nothing: increment, decrement, +=, -=, min and max return void, and there
+ * are no fetch_add, fetch_sub, fetch_min or fetch_max. Loads and stores flush
+ * pending updates first.
+ */
+template <typename T, typename Policy, typename MemoryOrder>
+class AtomicRef<T, combining_atomic<Policy>, MemoryOrder>
+{
+public:
+  using value_type = T;
+  using policy_type = combining_atomic<Policy>;
+
+  RAJA_INLINE
+  constexpr explicit AtomicRef(value_type *value_ptr)
+      : m_value_ptr(value_ptr){};
+
+  RAJA_INLINE
+  constexpr AtomicRef(AtomicRef const&c)
+      : m_value_ptr(c.m_value_ptr){};
+
+  AtomicRef& operator=(AtomicRef const&) = delete;
+
+  RAJA_INLINE
+  value_type volatile * getPointer() const { return m_value_ptr; }
+
+  RAJA_INLINE
+  void store(value_type rhs) const
+  {
+    RAJA::atomicStore<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  value_type operator=(value_type rhs) const
+  {
+    RAJA::atomicStore<policy_type, MemoryOrder>(m_value_ptr, rhs);
+    return rhs;
+  }
+
+  RAJA_INLINE
+  value_type load() const
+  {
+    return RAJA::atomicLoad<policy_type, MemoryOrder>(m_value_ptr);
+  }
+
+  RAJA_INLINE
+  operator value_type() const
+  {
+    return RAJA::atomicLoad<policy_type, MemoryOrder>(m_value_ptr);
+  }
+
+  RAJA_INLINE
+  value_type exchange(value_type rhs) const
+  {
+    return RAJA::atomicExchange<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  value_type CAS(value_type compare, value_type rhs) const
+  {
+    return RAJA::atomicCAS<policy_type, MemoryOrder>(m_value_ptr, compare, rhs);
+  }
+
+  RAJA_INLINE
+  bool compare_exchange_strong(value_type& expect, value_type rhs) const
+  {
+    value_type compare = expect;
+    value_type old =
+        RAJA::atomicCAS<policy_type, MemoryOrder>(m_value_ptr, compare, rhs);
+    if (compare == old) {
+      return true;
+    } else {
+      expect = old;
+      return false;
+    }
+  }
+
+  RAJA_INLINE
+  bool compare_exchange_weak(value_type& expect, value_type rhs) const
+  {
+    return this->compare_exchange_strong(expect, rhs);
+  }
+
+  RAJA_INLINE
+  void operator++() const
+  {
+    RAJA::atomicInc<policy_type, MemoryOrder>(m_value_ptr);
+  }
+
+  RAJA_INLINE
+  void operator++(int) const
+  {
+    RAJA::atomicInc<policy_type, MemoryOrder>(m_value_ptr);
+  }
+
+  RAJA_INLINE
+  void operator--() const
+  {
+    RAJA::atomicDec<policy_type, MemoryOrder>(m_value_ptr);
+  }
+
+  RAJA_INLINE
+  void operator--(int) const
+  {
+    RAJA::atomicDec<policy_type, MemoryOrder>(m_value_ptr);
+  }
+
+  RAJA_INLINE
+  void operator+=(value_type rhs) const
+  {
+    RAJA::atomicAdd<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  void operator-=(value_type rhs) const
+  {
+    RAJA::atomicSub<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  void min(value_type rhs) const
+  {
+    RAJA::atomicMin<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  void max(value_type rhs) const
+  {
+    RAJA::atomicMax<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  value_type fetch_and(value_type rhs) const
+  {
+    return RAJA::atomicAnd<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  value_type operator&=(value_type rhs) const
+  {
+    return RAJA::atomicAnd<policy_type, MemoryOrder>(m_value_ptr, rhs) & rhs;
+  }
+
+  RAJA_INLINE
+  value_type fetch_or(value_type rhs) const
+  {
+    return RAJA::atomicOr<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  value_type operator|=(value_type rhs) const
+  {
+    return RAJA::atomicOr<policy_type, MemoryOrder>(m_value_ptr, rhs) | rhs;
+  }
+
+  RAJA_INLINE
+  value_type fetch_xor(value_type rhs) const
+  {
+    return RAJA::atomicXor<policy_type, MemoryOrder>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE
+  value_type operator^=(value_type rhs) const
+  {
+    return RAJA::atomicXor<policy_type, MemoryOrder>(m_value_ptr, rhs) ^ rhs;
   }
 
 private:
@@ -281,24 +281,37 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
-  util::callPreCapturePlugins(context);
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (util::plugins_registered()) {
+    util::PluginContext context{
+        util::make_context<camp::decay<ExecutionPolicy>,
+                           camp::decay<LoopBody>>(
+            c.getLength())};
+    util::callPreCapturePlugins(context);
 
-  using RAJA::util::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+    using RAJA::util::trigger_updates_before;
+    auto body = trigger_updates_before(loop_body);
 
-  util::callPostCapturePlugins(context);
+    util::callPostCapturePlugins(context);
 
-  util::callPreLaunchPlugins(context);
+    util::callPreLaunchPlugins(context);
 
-  RAJA::resources::EventProxy<Res> e = wrap::forall_Icount(
+    RAJA::resources::EventProxy<Res> e = wrap::forall_Icount(
+        r,
+        std::forward<ExecutionPolicy>(p),
+        std::forward<IdxSet>(c),
+        std::move(body));
+
+    util::callPostLaunchPlugins(context);
+    return e;
+  }
+#endif
+
+  return wrap::forall_Icount(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<IdxSet>(c),
-      std::move(body));
-
-  util::callPostLaunchPlugins(context);
-  return e;
+      std::forward<LoopBody>(loop_body));
 }
 template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
           typename Res = typename resources::get_resource<ExecutionPolicy>::type >
@@ -331,24 +344,37 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
-  util::callPreCapturePlugins(context);
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (util::plugins_registered()) {
+    util::PluginContext context{
+        util::make_context<camp::decay<ExecutionPolicy>,
+                           camp::decay<LoopBody>>(
+            c.getLength())};
+    util::callPreCapturePlugins(context);
 
-  using RAJA::util::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+    using RAJA::util::trigger_updates_before;
+    auto body = trigger_updates_before(loop_body);
 
-  util::callPostCapturePlugins(context);
+    util::callPostCapturePlugins(context);
 
-  util::callPreLaunchPlugins(context);
+    util::callPreLaunchPlugins(context);
 
-  resources::EventProxy<Res> e = wrap::forall(
+    resources::EventProxy<Res> e = wrap::forall(
+        r,
+        std::forward<ExecutionPolicy>(p),
+        std::forward<IdxSet>(c),
+        std::move(body));
+
+    util::callPostLaunchPlugins(context);
+    return e;
+  }
+#endif
+
+  return wrap::forall(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<IdxSet>(c),
-      std::move(body));
-
-  util::callPostLaunchPlugins(context);
-  return e;
+      std::forward<LoopBody>(loop_body));
 }
 template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
           typename Res = typename resources::get_resource<ExecutionPolicy>::type >
@@ -416,25 +442,39 @@ forall_Icount(ExecutionPolicy&& p,
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
-  util::callPreCapturePlugins(context);
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (util::plugins_registered()) {
+    util::PluginContext context{
+        util::make_context<camp::decay<ExecutionPolicy>,
+                           camp::decay<LoopBody>>(
+            static_cast<size_t>(std::end(c) - std::begin(c)))};
+    util::callPreCapturePlugins(context);
 
-  using RAJA::util::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+    using RAJA::util::trigger_updates_before;
+    auto body = trigger_updates_before(loop_body);
 
-  util::callPostCapturePlugins(context);
+    util::callPostCapturePlugins(context);
 
-  util::callPreLaunchPlugins(context);
+    util::callPreLaunchPlugins(context);
 
-  resources::EventProxy<Res> e = wrap::forall_Icount(
+    resources::EventProxy<Res> e = wrap::forall_Icount(
+        r,
+        std::forward<ExecutionPolicy>(p),
+        std::forward<Container>(c),
+        icount,
+        std::move(body));
+
+    util::callPostLaunchPlugins(context);
+    return e;
+  }
+#endif
+
+  return wrap::forall_Icount(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<Container>(c),
       icount,
-      std::move(body));
-
-  util::callPostLaunchPlugins(context);
-  return e;
+      std::forward<LoopBody>(loop_body));
 }
 template <typename ExecutionPolicy,
           typename Container,
@@ -478,24 +518,37 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
-  util::callPreCapturePlugins(context);
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (util::plugins_registered()) {
+    util::PluginContext context{
+        util::make_context<camp::decay<ExecutionPolicy>,
+                           camp::decay<LoopBody>>(
+            static_cast<size_t>(std::end(c) - std::begin(c)))};
+    util::callPreCapturePlugins(context);
 
-  using RAJA::util::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+    using RAJA::util::trigger_updates_before;
+    auto body = trigger_updates_before(loop_body);
 
-  util::callPostCapturePlugins(context);
+    util::callPostCapturePlugins(context);
 
-  util::callPreLaunchPlugins(context);
+    util::callPreLaunchPlugins(context);
 
-  resources::EventProxy<Res> e =  wrap::forall(
+    resources::EventProxy<Res> e = wrap::forall(
+        r,
+        std::forward<ExecutionPolicy>(p),
+        std::forward<Container>(c),
+        std::move(body));
+
+    util::callPostLaunchPlugins(context);
+    return e;
+  }
+#endif
+
+  return wrap::forall(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<Container>(c),
-      std::move(body));
-
-  util::callPostLaunchPlugins(context);
-  return e;
+      std::forward<LoopBody>(loop_body));
 }
 template <typename ExecutionPolicy, typename Container, typename LoopBody,
           typename Res = typename resources::get_resource<ExecutionPolicy>::type >
@@ -0,0 +1,160 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA forall_fused, which runs several loop
+ *          bodies over one segment in a single traversal.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_forall_fused_HPP
+#define RAJA_pattern_forall_fused_HPP
+
+#include "RAJA/config.hpp"
+
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Loop body calling each of Bodies in turn on the same index.  The bodies
+ * are held by value, so privatizing the fused body privatizes each of them.
+ */
+template <typename... Bodies>
+struct FusedBody {
+  camp::tuple<Bodies...> bodies;
+
+  template <typename Index, camp::idx_t... Ids>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(Index const &i,
+                                         camp::idx_seq<Ids...>) const
+  {
+    camp::sink((camp::get<Ids>(bodies)(i), 0)...);
+  }
+
+  template <typename Index>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index const &i) const
+  {
+    call(i, camp::make_idx_seq_t<sizeof...(Bodies)>{});
+  }
+};
+
+/*!
+ * Loop body over chunks of chunk_size iterations of segment, calling each
+ * of Bodies on every iteration of a chunk before moving on to the next body.
+ */
+template <typename Segment, typename... Bodies>
+struct FusedChunkBody {
+  Segment segment;
+  Index_type len;
+  Index_type chunk_size;
+  camp::tuple<Bodies...> bodies;
+
+  template <typename Body>
+  RAJA_HOST_DEVICE RAJA_INLINE void call_chunk(Body const &body,
+                                               Index_type first,
+                                               Index_type last) const
+  {
+    auto const begin = segment.begin();
+    for (Index_type i = first; i < last; ++i) {
+      body(*(begin + i));
+    }
+  }
+
+  template <camp::idx_t... Ids>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(Index_type first,
+                                         Index_type last,
+                                         camp::idx_seq<Ids...>) const
+  {
+    camp::sink((call_chunk(camp::get<Ids>(bodies), first, last), 0)...);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index_type chunk) const
+  {
+    const Index_type first = chunk * chunk_size;
+    const Index_type last = first + chunk_size < len ? first + chunk_size : len;
+    call(first, last, camp::make_idx_seq_t<sizeof...(Bodies)>{});
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Run each of bodies on every iteration of segment in one forall.
+ *
+ * Equivalent to a sequence of RAJA::forall<ExecutionPolicy> calls, one per
+ * body, when the bodies are independent: at each index the bodies run in
+ * the order given, but one index may run before another index has finished.
+ * Arrays shared by the bodies are streamed through memory once, and OpenMP
+ * policies open one parallel region instead of one per body.
+ */
+template <typename ExecutionPolicy, typename Segment, typename... Bodies>
+RAJA_INLINE resources::EventProxy<
+    typename resources::get_resource<ExecutionPolicy>::type>
+forall_fused(Segment &&segment, Bodies &&... bodies)
+{
+  static_assert(sizeof...(Bodies) > 0, "forall_fused requires a loop body");
+
+  return forall<ExecutionPolicy>(
+      std::forward<Segment>(segment),
+      detail::FusedBody<camp::decay<Bodies>...>{
+          camp::make_tuple(std::forward<Bodies>(bodies)...)});
+}
+
+/*!
+ * \brief Run bodies over chunk_size iterations of segment at a time, in one
+ * forall over the chunks.
+ *
+ * Each body runs on every iteration of a chunk before the next body starts
+ * on the chunk, so a body may read what earlier bodies wrote anywhere in the
+ * same chunk, e.g. neighboring entries. Choosing chunk_size so the data
+ * touched by a chunk fits in cache keeps the traffic of a single traversal.
+ */
+template <typename ExecutionPolicy, typename Segment, typename... Bodies>
+RAJA_INLINE resources::EventProxy<
+    typename resources::get_resource<ExecutionPolicy>::type>
+forall_fused_chunked(Index_type chunk_size,
+                     Segment &&segment,
+                     Bodies &&... bodies)
+{
+  static_assert(sizeof...(Bodies) > 0,
+                "forall_fused_chunked requires a loop body");
+
+  const Index_type len = segment.end() - segment.begin();
+  if (chunk_size <= 0) {
+    chunk_size = len > 0 ? len : 1;
+  }
+  const Index_type num_chunks = (len + chunk_size - 1) / chunk_size;
+
+  return forall<ExecutionPolicy>(
+      TypedRangeSegment<Index_type>(0, num_chunks),
+      detail::FusedChunkBody<camp::decay<Segment>, camp::decay<Bodies>...>{
+          std::forward<Segment>(segment),
+          len,
+          chunk_size,
+          camp::make_tuple(std::forward<Bodies>(bodies)...)});
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
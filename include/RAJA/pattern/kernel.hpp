@@ -82,6 +82,15 @@ RAJA_INLINE constexpr auto make_wrapped_tuple_impl(Tuple &&t,
               IndexType>{camp::get<I>(std::forward<Tuple>(t)).begin(),
                          camp::get<I>(std::forward<Tuple>(t)).end()}...);
 }
+
+template <class Tuple, camp::idx_t... I>
+RAJA_INLINE size_t segment_tuple_size(Tuple const &t, camp::idx_seq<I...>)
+{
+  size_t size = 1;
+  camp::sink((size *= static_cast<size_t>(camp::get<I>(t).end() -
+                                          camp::get<I>(t).begin()))...);
+  return size;
+}
 }  // namespace internal
 
 template <class Tuple>
@@ -106,7 +115,18 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                                                   Resource resource,
                                                                   Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  using first_body_t =
+      camp::tuple_element_t<0, camp::tuple<camp::decay<Bodies>...>>;
+
+  // The context is only filled in when there is a plugin to look at it
+  const bool plugins = util::plugins_registered();
+  util::PluginContext context{
+      plugins ? util::make_context<PolicyType, first_body_t>(
+                    internal::segment_tuple_size(
+                        segments,
+                        camp::make_idx_seq_t<camp::tuple_size<
+                            camp::decay<SegmentTuple>>::value>{}))
+              : util::PluginContext{Platform::undefined}};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -125,7 +145,7 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                          camp::decay<Bodies>...>;
 
 
-  util::callPreCapturePlugins(context);
+  if (plugins) util::callPreCapturePlugins(context);
 
   // Create the LoopData object, which contains our policy object,
   // our segments, loop bodies, and the tuple of loop indices
@@ -137,17 +157,17 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                             resource,
                             std::forward<Bodies>(bodies)...);
 
-  util::callPostCapturePlugins(context);
+  if (plugins) util::callPostCapturePlugins(context);
 
   using loop_types_t = internal::makeInitialLoopTypes<loop_data_t>;
 
-  util::callPreLaunchPlugins(context);
+  if (plugins) util::callPreLaunchPlugins(context);
 
   // Execute!
   RAJA_FORCEINLINE_RECURSIVE
   internal::execute_statement_list<PolicyType, loop_types_t>(loop_data);
 
-  util::callPostLaunchPlugins(context);
+  if (plugins) util::callPostLaunchPlugins(context);
 
   return resources::EventProxy<Resource>(resource);
 }
@@ -200,10 +220,12 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
 #include "RAJA/pattern/kernel/Conditional.hpp"
 #include "RAJA/pattern/kernel/For.hpp"
 #include "RAJA/pattern/kernel/ForICount.hpp"
+#include "RAJA/pattern/kernel/Fused.hpp"
 #include "RAJA/pattern/kernel/Hyperplane.hpp"
 #include "RAJA/pattern/kernel/InitLocalMem.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
 #include "RAJA/pattern/kernel/Param.hpp"
+#include "RAJA/pattern/kernel/RecursiveTile.hpp"
 #include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/Region.hpp"
 #include "RAJA/pattern/kernel/Tile.hpp"
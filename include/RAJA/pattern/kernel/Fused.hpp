@@ -0,0 +1,68 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for kernel statements that fuse several loop bodies
+ *          into one traversal.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_Fused_HPP
+#define RAJA_pattern_kernel_Fused_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/Lambda.hpp"
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+/*!
+ * A RAJA::kernel statement that runs the bodies BodyIds, in order, on each
+ * iteration of loop ArgumentId; the kernel counterpart of forall_fused.
+ *
+ *   RAJA::kernel<KernelPolicy<statement::FusedFor<0, omp_parallel_for_exec,
+ *                                                 0, 1, 2>>>(
+ *       make_tuple(seg), body0, body1, body2);
+ *
+ */
+template <camp::idx_t ArgumentId, typename ExecPolicy, camp::idx_t... BodyIds>
+using FusedFor = For<ArgumentId, ExecPolicy, Lambda<BodyIds>...>;
+
+/*!
+ * A RAJA::kernel statement that runs the bodies BodyIds over chunks of
+ * ChunkSize iterations of loop ArgumentId, each body over the whole chunk
+ * before the next; the kernel counterpart of forall_fused_chunked.  Chunks
+ * are distributed by ExecPolicy.
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t ChunkSize,
+          typename ExecPolicy,
+          camp::idx_t... BodyIds>
+using FusedChunkFor = Tile<ArgumentId,
+                           tile_fixed<ChunkSize>,
+                           ExecPolicy,
+                           For<ArgumentId, loop_exec, Lambda<BodyIds>>...>;
+
+}  // end namespace statement
+
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_Fused_HPP */
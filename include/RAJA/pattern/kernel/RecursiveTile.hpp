@@ -0,0 +1,255 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for cache-oblivious recursive tiling of kernel loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_RecursiveTile_HPP
+#define RAJA_pattern_kernel_RecursiveTile_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that tiles the loops of ArgList by recursive
+ * bisection.
+ *
+ * The box spanned by the segments of ArgList is split in half along its
+ * longest dimension, and each half is split again in turn, until no
+ * dimension is longer than the leaf size of ExecPolicy.  The segments are
+ * then restricted to the leaf box and the enclosed statements are executed,
+ * with For statements inside iterating over the leaf.
+ *
+ * The recursion yields tiles that fit each level of the memory hierarchy
+ * without tuning a tile size per cache level or machine, as in M. Frigo et
+ * al., "Cache-oblivious algorithms", FOCS 1999.
+ *
+ *   using Pol = KernelPolicy<
+ *     statement::RecursiveTile<ArgList<0, 1>, cache_oblivious_exec<32>,
+ *       statement::For<1, seq_exec,
+ *         statement::For<0, seq_exec, statement::Lambda<0>>>>>;
+ *
+ */
+template <typename TileList, typename ExecPolicy, typename... EnclosedStmts>
+struct RecursiveTile : public internal::Statement<ExecPolicy, EnclosedStmts...> {
+  using exec_policy_t = ExecPolicy;
+};
+
+}  // end namespace statement
+
+///! policy for a sequential recursive tiling with leaves of at most LeafSize
+///! iterations per dimension
+template <camp::idx_t LeafSize = 32>
+struct cache_oblivious_exec {
+  static constexpr camp::idx_t leaf_size = LeafSize;
+};
+
+
+namespace internal
+{
+
+/*!
+ * Offsets and lengths of a box of iterations, relative to the segments
+ * being tiled.
+ */
+template <camp::idx_t NumDims>
+struct RecursiveTileBox {
+  Index_type begin[NumDims];
+  Index_type length[NumDims];
+
+  RAJA_INLINE bool empty() const
+  {
+    for (camp::idx_t d = 0; d < NumDims; ++d) {
+      if (length[d] <= 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /*!
+   * Bisect the longest dimension into lo and hi if it is longer than
+   * leaf_size, returning whether the box was split
+   */
+  RAJA_INLINE bool split(camp::idx_t leaf_size,
+                         RecursiveTileBox &lo,
+                         RecursiveTileBox &hi) const
+  {
+    camp::idx_t dim = 0;
+    for (camp::idx_t d = 1; d < NumDims; ++d) {
+      if (length[d] > length[dim]) {
+        dim = d;
+      }
+    }
+    if (length[dim] <= leaf_size) {
+      return false;
+    }
+
+    lo = *this;
+    hi = *this;
+    lo.length[dim] = length[dim] / 2;
+    hi.begin[dim] = begin[dim] + lo.length[dim];
+    hi.length[dim] = length[dim] - lo.length[dim];
+    return true;
+  }
+};
+
+
+/*!
+ * Recursion shared by the RecursiveTile executors.  Segments holds copies of
+ * the untiled segments of Args, which each leaf slices into the data.
+ */
+template <typename TileList, typename Types, typename... EnclosedStmts>
+struct RecursiveTileExecutor;
+
+template <camp::idx_t... Args, typename Types, typename... EnclosedStmts>
+struct RecursiveTileExecutor<ArgList<Args...>, Types, EnclosedStmts...> {
+
+  static constexpr camp::idx_t num_dims = sizeof...(Args);
+
+  using box_type = RecursiveTileBox<num_dims>;
+
+  template <typename Data>
+  using segments_type = camp::tuple<camp::decay<
+      decltype(camp::get<Args>(camp::val<camp::decay<Data>>().segment_tuple))>...>;
+
+  template <typename Data>
+  static RAJA_INLINE segments_type<Data> get_segments(Data const &data)
+  {
+    return segments_type<Data>(camp::get<Args>(data.segment_tuple)...);
+  }
+
+  template <typename Segments, camp::idx_t... Dims>
+  static RAJA_INLINE box_type make_box(Segments const &segments,
+                                       camp::idx_seq<Dims...>)
+  {
+    const Index_type lengths[num_dims] = {
+        static_cast<Index_type>(camp::get<Dims>(segments).end() -
+                                camp::get<Dims>(segments).begin())...};
+
+    box_type box;
+    for (camp::idx_t d = 0; d < num_dims; ++d) {
+      box.begin[d] = 0;
+      box.length[d] = lengths[d];
+    }
+    return box;
+  }
+
+  template <typename Segments>
+  static RAJA_INLINE box_type make_box(Segments const &segments)
+  {
+    return make_box(segments, camp::make_idx_seq_t<num_dims>{});
+  }
+
+  template <typename Data, typename Segments, camp::idx_t... Dims>
+  static RAJA_INLINE void assign_segments(Data &data,
+                                          Segments const &segments,
+                                          box_type const &box,
+                                          camp::idx_seq<Dims...>)
+  {
+    camp::sink((camp::get<Args>(data.segment_tuple) =
+                    camp::get<Dims>(segments).slice(box.begin[Dims],
+                                                    box.length[Dims]),
+                0)...);
+  }
+
+  template <typename Data, typename Segments, camp::idx_t... Dims>
+  static RAJA_INLINE void restore_segments(Data &data,
+                                           Segments const &segments,
+                                           camp::idx_seq<Dims...>)
+  {
+    camp::sink(
+        (camp::get<Args>(data.segment_tuple) = camp::get<Dims>(segments), 0)...);
+  }
+
+  template <typename Data, typename Segments>
+  static RAJA_INLINE void restore_segments(Data &data, Segments const &segments)
+  {
+    restore_segments(data, segments, camp::make_idx_seq_t<num_dims>{});
+  }
+
+  /*!
+   * Sequential recursion over box, executing the enclosed statements on
+   * each leaf in order
+   */
+  template <typename Data, typename Segments>
+  static void recurse(Data &data,
+                      Segments const &segments,
+                      box_type const &box,
+                      camp::idx_t leaf_size)
+  {
+    box_type lo, hi;
+    if (box.split(leaf_size, lo, hi)) {
+      recurse(data, segments, lo, leaf_size);
+      recurse(data, segments, hi, leaf_size);
+      return;
+    }
+
+    assign_segments(data, segments, box, camp::make_idx_seq_t<num_dims>{});
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+  }
+};
+
+
+/*!
+ * A RAJA::kernel executor for statement::RecursiveTile that visits the
+ * leaves sequentially
+ */
+template <camp::idx_t... Args,
+          camp::idx_t LeafSize,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::RecursiveTile<ArgList<Args...>,
+                                                  cache_oblivious_exec<LeafSize>,
+                                                  EnclosedStmts...>,
+                         Types> {
+
+  static_assert(LeafSize > 0, "cache_oblivious_exec leaf size must be positive");
+
+  using Base = RecursiveTileExecutor<ArgList<Args...>, Types, EnclosedStmts...>;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    auto segments = Base::get_segments(data);
+    auto box = Base::make_box(segments);
+
+    if (!box.empty()) {
+      Base::recurse(data, segments, box, LeafSize);
+    }
+
+    // Set ranges back to original values
+    Base::restore_segments(data, segments);
+  }
+};
+
+}  // end namespace internal
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_RecursiveTile_HPP */
@@ -117,6 +117,24 @@ template<typename Types, camp::idx_t Segment, typename Data>
 using setSegmentTypeFromData =
     setSegmentType<Types, Segment, camp::at_v<typename camp::decay<Data>::index_tuple_t::TList, Segment>>;
 
+// Apply setSegmentTypeFromData for each of several segments in turn, as
+// for the arguments of a collapsed loop nest
+template<typename Types, typename Data, camp::idx_t ... Segments>
+struct CollapseSegmentTypes {
+  using type = Types;
+};
+
+template<typename Types,
+         typename Data,
+         camp::idx_t Segment0,
+         camp::idx_t ... Segments>
+struct CollapseSegmentTypes<Types, Data, Segment0, Segments...> {
+  using type = typename CollapseSegmentTypes<
+      setSegmentTypeFromData<Types, Segment0, Data>,
+      Data,
+      Segments...>::type;
+};
+
 
 }  // end namespace internal
 }  // end namespace RAJA
@@ -0,0 +1,69 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA pipeline, which runs a sequence of
+ *          element-wise dependent loops chunk by chunk.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_pipeline_HPP
+#define RAJA_pattern_pipeline_HPP
+
+#include "RAJA/config.hpp"
+
+#include <utility>
+
+#include "RAJA/pattern/forall_fused.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Run a sequence of loops over segment as a pipeline of stages, each
+ * thread taking its chunks of chunk_size iterations through every stage.
+ *
+ * The stages are loop bodies called as stage(i).  Stage k at index i may
+ * depend on the earlier stages at any index of the same chunk, e.g. on
+ * stage k - 1 at i, but not at indices of other chunks.  Each thread runs
+ * all the stages on one chunk before starting its next chunk, so there is
+ * no barrier between stages and a chunk small enough to stay in cache is
+ * produced and consumed without a round trip to memory.
+ *
+ * The pipeline is a RAJA::forall_fused_chunked with the stages as its
+ * bodies, so the chunks are distributed by ExecutionPolicy as a forall over
+ * chunks would be, and any forall policy may be used.  Reducers captured by
+ * the stages are privatized as by forall and so may be updated by any of
+ * the stages.  Unlike forall_fused_chunked, chunk_size must be positive.
+ */
+template <typename ExecutionPolicy, typename Segment, typename... Stages>
+RAJA_INLINE resources::EventProxy<
+    typename resources::get_resource<ExecutionPolicy>::type>
+pipeline(Index_type chunk_size, Segment &&segment, Stages &&... stages)
+{
+  static_assert(sizeof...(Stages) > 0, "pipeline requires a stage");
+
+  if (chunk_size <= 0) {
+    RAJA_ABORT_OR_THROW("pipeline chunk size must be positive");
+  }
+
+  return forall_fused_chunked<ExecutionPolicy>(
+      chunk_size,
+      std::forward<Segment>(segment),
+      std::forward<Stages>(stages)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
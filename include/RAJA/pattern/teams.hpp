@@ -39,4 +39,8 @@
 #include "RAJA/policy/openmp/teams.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_TBB)
+#include "RAJA/policy/tbb/teams.hpp"
+#endif
+
 #endif /* RAJA_pattern_teams_HPP */
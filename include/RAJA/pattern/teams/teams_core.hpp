@@ -18,7 +18,10 @@
 #ifndef RAJA_pattern_teams_core_HPP
 #define RAJA_pattern_teams_core_HPP
 
+#include <memory>
+
 #include "RAJA/config.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/macros.hpp"
@@ -133,6 +136,7 @@ public:
   Teams teams;
   Threads threads;
   Lanes lanes;
+  size_t shared_mem_size{0};
   const char *kernel_name{nullptr};
 
   RAJA_INLINE
@@ -141,6 +145,19 @@ public:
   Grid(Teams in_teams, Threads in_threads, const char *in_kernel_name = nullptr)
     : teams(in_teams), threads(in_threads), kernel_name(in_kernel_name){};
 
+  //
+  // shared_mem_size is the number of bytes of team scratch memory made
+  // available through LaunchContext::getSharedMemory
+  //
+  Grid(Teams in_teams,
+       Threads in_threads,
+       size_t in_shared_mem_size,
+       const char *in_kernel_name = nullptr)
+    : teams(in_teams),
+      threads(in_threads),
+      shared_mem_size(in_shared_mem_size),
+      kernel_name(in_kernel_name){};
+
 private:
   RAJA_HOST_DEVICE
   RAJA_INLINE
@@ -156,35 +173,264 @@ private:
 };
 
 
+namespace detail
+{
+
+//
+// Team scratch memory owned by a host thread, for host launch policies
+// whose teams run as tasks on whichever thread picks them up.  A team
+// allocates from the buffer of the thread executing it, which must not
+// start another team until the first releases its memory.
+//
+struct HostThreadSharedMemory {
+
+  std::unique_ptr<void, RAJA::FreeAligned> buffer;
+  size_t capacity{0};
+  size_t offset{0};
+
+  static HostThreadSharedMemory &get()
+  {
+    static thread_local HostThreadSharedMemory mem;
+    return mem;
+  }
+
+  void *allocate(size_t size, size_t align, size_t bytes)
+  {
+    if (offset == 0 && capacity < size) {
+      buffer.reset(RAJA::allocate_aligned(RAJA::DATA_ALIGN, size));
+      capacity = size;
+    }
+
+    offset = (offset + align - 1) / align * align;
+    if (offset + bytes > size || offset + bytes > capacity) {
+      RAJA_ABORT_OR_THROW("Requested more team shared memory than was "
+                          "reserved in the launch Grid");
+    }
+
+    void *ptr = static_cast<char *>(buffer.get()) + offset;
+    offset += bytes;
+    return ptr;
+  }
+};
+
+struct HostTeamScratch;
+
+}  // namespace detail
+
 class LaunchContext : public Grid
 {
 public:
 
+  //
+  // Team scratch memory, set up by the launch policy; on the device this is
+  // dynamic shared memory, on the host it is a buffer owned by the thread
+  // executing the team
+  //
+  void *shared_mem_ptr{nullptr};
+  size_t shared_mem_offset{0};
+
+  //
+  // Set by host launch policies that execute a team with a group of OpenMP
+  // threads, in which case teamSync() is a barrier across the group and
+  // host_team_level is the OpenMP level of the region whose threads are the
+  // groups
+  //
+  bool host_team_barrier{false};
+  int host_team_level{0};
+
+  //
+  // Set by host launch policies that run teams as tasks (tbb_launch_t), in
+  // which case team scratch memory belongs to the executing thread
+  //
+  bool host_thread_shared_mem{false};
+
+  //
+  // Set by OpenMP launch policies to per-thread slots shared by the threads
+  // of the team, holding the partial results of team reductions and scans
+  //
+  detail::HostTeamScratch *host_team_scratch{nullptr};
+
   LaunchContext(Grid const &base)
       : Grid(base)
   {
   }
 
+  /*!
+   * Return a pointer to num_elem objects of type T carved out of the team
+   * scratch memory.  Allocations are bump allocated and are released all at
+   * once with releaseSharedMemory().
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE T *getSharedMemory(size_t num_elem)
+  {
+    const size_t align = alignof(T);
+
+#if !defined(RAJA_DEVICE_CODE)
+    if (host_thread_shared_mem) {
+      return static_cast<T *>(detail::HostThreadSharedMemory::get().allocate(
+          shared_mem_size, align, num_elem * sizeof(T)));
+    }
+#endif
+
+    shared_mem_offset = (shared_mem_offset + align - 1) / align * align;
+
+#if !defined(RAJA_DEVICE_CODE)
+    if (shared_mem_offset + num_elem * sizeof(T) > shared_mem_size) {
+      RAJA_ABORT_OR_THROW("Requested more team shared memory than was "
+                          "reserved in the launch Grid");
+    }
+#endif
+
+    T *mem_ptr = reinterpret_cast<T *>(static_cast<char *>(shared_mem_ptr) +
+                                       shared_mem_offset);
+    shared_mem_offset += num_elem * sizeof(T);
+    return mem_ptr;
+  }
+
+  RAJA_HOST_DEVICE
+  void releaseSharedMemory()
+  {
+#if !defined(RAJA_DEVICE_CODE)
+    // the context is shared by the tasks running teams, so only the memory
+    // of the executing thread is released
+    if (host_thread_shared_mem) {
+      detail::HostThreadSharedMemory::get().offset = 0;
+      return;
+    }
+#endif
+    shared_mem_offset = 0;
+  }
+
   RAJA_HOST_DEVICE
   void teamSync()
   {
 #if defined(RAJA_DEVICE_CODE)
     __syncthreads();
+#elif defined(RAJA_ENABLE_OPENMP)
+    if (host_team_barrier) {
+#pragma omp barrier
+    }
 #endif
   }
 };
 
+namespace detail
+{
+
+//
+// Team scratch memory for one host thread; host launch policies run whole
+// teams on a thread one after another, so the buffer is reused across teams
+//
+struct HostTeamSharedMemory {
+
+  std::unique_ptr<void, RAJA::FreeAligned> buffer;
+
+  explicit HostTeamSharedMemory(size_t bytes)
+      : buffer(bytes > 0 ? RAJA::allocate_aligned(RAJA::DATA_ALIGN, bytes)
+                         : nullptr)
+  {
+  }
+
+  void *get() const { return buffer.get(); }
+};
+
+//
+// Plugin context for a launch; the iteration space is the total number of
+// team threads and the kernel is named by the Grid when a name was given
+//
+template <typename LAUNCH_POLICY, typename BODY>
+util::PluginContext make_launch_context(Grid const &grid)
+{
+  size_t size = 1;
+  for (int i = 0; i < 3; ++i) {
+    size *= static_cast<size_t>(grid.teams.value[i]) *
+            static_cast<size_t>(grid.threads.value[i]);
+  }
+  return util::make_context<LAUNCH_POLICY, BODY>(size, grid.kernel_name);
+}
+
+}  // namespace detail
+
 template <typename LAUNCH_POLICY>
 struct LaunchExecute;
 
+namespace detail
+{
+
+//
+// Execute a launch with LAUNCH_POLICY.  When a plugin is registered the
+// hooks are called around it and the body is copied, so plugins observe the
+// capture; otherwise the body is passed on without a copy.
+//
+template <typename LAUNCH_POLICY, typename BODY>
+void launch_with_plugins(Grid const &grid, BODY const &body)
+{
+  using launch_t = LaunchExecute<LAUNCH_POLICY>;
+
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (util::plugins_registered()) {
+    util::PluginContext context{make_launch_context<LAUNCH_POLICY, BODY>(grid)};
+    util::callPreCapturePlugins(context);
+
+    using RAJA::util::trigger_updates_before;
+    auto p_body = trigger_updates_before(body);
+
+    util::callPostCapturePlugins(context);
+
+    util::callPreLaunchPlugins(context);
+
+    launch_t::exec(LaunchContext(grid), p_body);
+
+    util::callPostLaunchPlugins(context);
+    return;
+  }
+#endif
+
+  launch_t::exec(LaunchContext(grid), body);
+}
+
+template <typename LAUNCH_POLICY, typename BODY>
+resources::EventProxy<resources::Resource>
+launch_with_plugins(RAJA::resources::Resource res,
+                    Grid const &grid,
+                    BODY const &body)
+{
+  using launch_t = LaunchExecute<LAUNCH_POLICY>;
+
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (util::plugins_registered()) {
+    util::PluginContext context{make_launch_context<LAUNCH_POLICY, BODY>(grid)};
+    util::callPreCapturePlugins(context);
+
+    using RAJA::util::trigger_updates_before;
+    auto p_body = trigger_updates_before(body);
+
+    util::callPostCapturePlugins(context);
+
+    util::callPreLaunchPlugins(context);
+
+    resources::EventProxy<resources::Resource> e =
+        launch_t::exec(res, LaunchContext(grid), p_body);
+
+    util::callPostLaunchPlugins(context);
+    return e;
+  }
+#endif
+
+  return launch_t::exec(res, LaunchContext(grid), body);
+}
+
+}  // namespace detail
+
 //Policy based launch
 template <typename LAUNCH_POLICY, typename BODY>
 void launch(Grid const &grid, BODY const &body)
 {
   //Take the first policy as we assume the second policy is not user defined.
   //We rely on the user to pair launch and loop policies correctly.
-  using launch_t = LaunchExecute<typename LAUNCH_POLICY::host_policy_t>;
-  launch_t::exec(LaunchContext(grid), body);
+  using launch_policy_t = typename LAUNCH_POLICY::host_policy_t;
+
+  detail::launch_with_plugins<launch_policy_t>(grid, body);
 }
 
 
@@ -194,14 +440,16 @@ void launch(ExecPlace place, Grid const &grid, BODY const &body)
 {
   switch (place) {
     case HOST: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
-      launch_t::exec(LaunchContext(grid), body);
+      using launch_policy_t = typename POLICY_LIST::host_policy_t;
+
+      detail::launch_with_plugins<launch_policy_t>(grid, body);
       break;
     }
 #ifdef RAJA_DEVICE_ACTIVE
     case DEVICE: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
-      launch_t::exec(LaunchContext(grid), body);
+      using launch_policy_t = typename POLICY_LIST::device_policy_t;
+
+      detail::launch_with_plugins<launch_policy_t>(grid, body);
       break;
     }
 #endif
@@ -242,13 +490,15 @@ launch(RAJA::resources::Resource res, Grid const &grid, BODY const &body)
 
   switch (place) {
     case HOST: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
-      return launch_t::exec(res, LaunchContext(grid), body); break;
+      using launch_policy_t = typename POLICY_LIST::host_policy_t;
+
+      return detail::launch_with_plugins<launch_policy_t>(res, grid, body);
     }
 #ifdef RAJA_DEVICE_ACTIVE
     case DEVICE: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
-      return launch_t::exec(res, LaunchContext(grid), body); break;
+      using launch_policy_t = typename POLICY_LIST::device_policy_t;
+
+      return detail::launch_with_plugins<launch_policy_t>(res, grid, body);
     }
 #endif
     default: {
@@ -333,6 +583,81 @@ RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
 
 
 
+template <typename POLICY, typename SEGMENT>
+struct LoopReduceExecute;
+
+template <typename POLICY, typename SEGMENT>
+struct LoopScanExecute;
+
+/*!
+ * Team scope reduction: combines body(i) over the segment with the
+ * reduction operator.  Every thread that participates in the loop receives
+ * op(init, result).
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename T,
+          typename REDUCE_OP,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE T loop_reduce(CONTEXT const &ctx,
+                                           SEGMENT const &segment,
+                                           T init,
+                                           REDUCE_OP const &op,
+                                           BODY const &body)
+{
+
+  return LoopReduceExecute<loop_policy<POLICY_LIST>, SEGMENT>::exec(ctx,
+                                                                    segment,
+                                                                    init,
+                                                                    op,
+                                                                    body);
+}
+
+/*!
+ * Team scope in-place inclusive scan of data[i] for i in the segment,
+ * typically used on team shared memory.
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename T,
+          typename SCAN_OP>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_inclusive_scan(CONTEXT const &ctx,
+                                                      SEGMENT const &segment,
+                                                      T *data,
+                                                      SCAN_OP const &op)
+{
+
+  LoopScanExecute<loop_policy<POLICY_LIST>, SEGMENT>::inclusive(ctx,
+                                                                segment,
+                                                                data,
+                                                                op);
+}
+
+/*!
+ * Team scope in-place exclusive scan of data[i] for i in the segment,
+ * starting from init.
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename T,
+          typename SCAN_OP>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_exclusive_scan(CONTEXT const &ctx,
+                                                      SEGMENT const &segment,
+                                                      T *data,
+                                                      SCAN_OP const &op,
+                                                      T init)
+{
+
+  LoopScanExecute<loop_policy<POLICY_LIST>, SEGMENT>::exclusive(ctx,
+                                                                segment,
+                                                                data,
+                                                                op,
+                                                                init);
+}
+
 
 template <typename POLICY, typename SEGMENT>
 struct TileExecute;
@@ -0,0 +1,195 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA temporal blocking of stencil sweeps.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_temporal_HPP
+#define RAJA_pattern_temporal_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Shape of the blocks of a temporal_block sweep.
+ *
+ * radius     - largest distance, along the tiled dimension, between a point
+ *              and the points of the previous time level it reads
+ * tile_size  - number of points of the tiled dimension per block
+ * time_block - number of time steps run on a block before moving on; it is
+ *              reduced to tile_size / (2 * radius) if larger
+ */
+struct TemporalTiling {
+  Index_type radius;
+  Index_type tile_size;
+  Index_type time_block;
+};
+
+namespace detail
+{
+
+//
+// Loops over the untiled segments D..N-1 of a temporal_block sweep
+//
+template <camp::idx_t D, camp::idx_t N>
+struct TemporalLoopNest {
+  template <typename Segments, typename Body, typename... Indices>
+  static RAJA_INLINE void exec(Segments const &segments,
+                               Body const &body,
+                               Indices... indices)
+  {
+    auto const &segment = camp::get<D>(segments);
+    for (auto it = segment.begin(); it != segment.end(); ++it) {
+      TemporalLoopNest<D + 1, N>::exec(segments, body, indices..., *it);
+    }
+  }
+};
+
+template <camp::idx_t N>
+struct TemporalLoopNest<N, N> {
+  template <typename Segments, typename Body, typename... Indices>
+  static RAJA_INLINE void exec(Segments const &,
+                               Body const &body,
+                               Indices... indices)
+  {
+    body(indices...);
+  }
+};
+
+//
+// Run time step t on the points [first, last) of the tiled segment
+//
+template <typename Segments, typename Body>
+RAJA_INLINE void temporal_step(Segments const &segments,
+                               Body const &body,
+                               Index_type t,
+                               Index_type first,
+                               Index_type last)
+{
+  constexpr camp::idx_t num_segs = camp::tuple_size<Segments>::value;
+  auto const begin = camp::get<0>(segments).begin();
+  for (Index_type x = first; x < last; ++x) {
+    TemporalLoopNest<1, num_segs>::exec(segments, body, t, *(begin + x));
+  }
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Run num_steps time steps of a stencil sweep, several steps per
+ * cache-resident block.
+ *
+ * The body is called as body(t, i0, i1, ...) for each time step t in
+ * [0, num_steps) and each point of the iteration space spanned by the
+ * segments, the first being the outermost loop.  It computes time level
+ * t + 1 of the point from time level t, reading points of level t no
+ * further than tiling.radius away along the first segment.  Time levels
+ * must be kept in separate storage rotated by t, e.g. two arrays selected
+ * by t % 2, with boundary values present in each.
+ *
+ * The first segment is cut into blocks of tiling.tile_size points, and
+ * each group of tiling.time_block steps runs in two phases, each a
+ * RAJA::forall with ExecPolicy:
+ *
+ *  - each block runs the steps on a trapezoid that shrinks by radius
+ *    points on every side facing another block, so it needs no data
+ *    computed by its neighbors;
+ *  - each interface between blocks then fills in the inverted trapezoid
+ *    left between the two blocks on either side of it.
+ *
+ * Every point is updated once per time step, in an order that respects
+ * the stencil dependences, and the steps of a phase reuse the block while
+ * it is in cache.  This is the split-tiling form of trapezoid (diamond)
+ * temporal blocking, applied along the first segment.
+ */
+template <typename ExecPolicy, typename... Segments, typename Body>
+void temporal_block(Index_type num_steps,
+                    TemporalTiling const &tiling,
+                    camp::tuple<Segments...> const &segments,
+                    Body const &body)
+{
+  static_assert(sizeof...(Segments) > 0,
+                "temporal_block requires at least one segment");
+
+  auto const &segment = camp::get<0>(segments);
+  const Index_type len = segment.end() - segment.begin();
+  if (num_steps <= 0 || len <= 0) {
+    return;
+  }
+
+  const Index_type radius = tiling.radius > 0 ? tiling.radius : 0;
+  const Index_type tile_size =
+      tiling.tile_size > 0 && tiling.tile_size < len ? tiling.tile_size : len;
+
+  Index_type time_block = tiling.time_block > 0 ? tiling.time_block : 1;
+  if (radius > 0 && time_block > tile_size / (2 * radius)) {
+    time_block = tile_size / (2 * radius) > 0 ? tile_size / (2 * radius) : 1;
+  }
+
+  // the last block also takes the points left over by the others, so every
+  // block is at least tile_size points and its trapezoid is never empty
+  const Index_type num_tiles = len / tile_size;
+
+  auto const tile_first = [=](Index_type k) { return k * tile_size; };
+  auto const tile_last = [=](Index_type k) {
+    return k + 1 == num_tiles ? len : (k + 1) * tile_size;
+  };
+
+  for (Index_type t0 = 0; t0 < num_steps; t0 += time_block) {
+    const Index_type steps =
+        time_block < num_steps - t0 ? time_block : num_steps - t0;
+
+    // upright trapezoids, one per block
+    forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, num_tiles),
+                       [=](Index_type k) {
+      const Index_type lo_shrink = k > 0 ? radius : 0;
+      const Index_type hi_shrink = k + 1 < num_tiles ? radius : 0;
+      for (Index_type s = 0; s < steps; ++s) {
+        detail::temporal_step(segments,
+                              body,
+                              t0 + s,
+                              tile_first(k) + lo_shrink * s,
+                              tile_last(k) - hi_shrink * s);
+      }
+    });
+
+    // inverted trapezoids, one per interface between blocks
+    if (radius > 0 && steps > 1) {
+      forall<ExecPolicy>(TypedRangeSegment<Index_type>(1, num_tiles),
+                         [=](Index_type k) {
+        const Index_type x = tile_first(k);
+        for (Index_type s = 1; s < steps; ++s) {
+          detail::temporal_step(
+              segments, body, t0 + s, x - radius * s, x + radius * s);
+        }
+      });
+    }
+  }
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -22,6 +22,8 @@
 
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/policy/atomic_order.hpp"
+
 #if !defined(RAJA_ENABLE_DESUL_ATOMICS)
     #include "RAJA/policy/sequential/atomic.hpp"
 #endif
@@ -60,6 +62,17 @@ namespace RAJA
 struct auto_atomic {
 };
 
+namespace detail
+{
+
+//! auto_atomic is ordered like the policy it selects
+template <typename Order>
+struct atomic_order_fence<auto_atomic, Order>
+    : atomic_order_fence<decltype(RAJA_AUTO_ATOMIC), Order> {
+};
+
+}  // namespace detail
+
 
 template <typename T>
 RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(auto_atomic, T volatile *acc, T value)
@@ -20,6 +20,10 @@
 
 #include "RAJA/config.hpp"
 
+#include <type_traits>
+
+#include "RAJA/policy/atomic_order.hpp"
+
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
 
@@ -42,10 +46,14 @@ namespace detail
 
 #if defined(RAJA_COMPILER_MSVC) || (defined(_WIN32) && defined(__INTEL_COMPILER))
 
-RAJA_DEVICE_HIP
-RAJA_INLINE unsigned builtin_atomic_CAS(unsigned volatile *acc,
-                                        unsigned compare,
-                                        unsigned value)
+//
+// The Interlocked routines are full barriers, so they satisfy every order
+//
+template <typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE unsigned builtin_atomic_CAS(Order,
+                                                        unsigned volatile *acc,
+                                                        unsigned compare,
+                                                        unsigned value)
 {
 
   long long_value = RAJA::util::reinterp_A_as_B<unsigned, long>(value);
@@ -56,8 +64,9 @@ RAJA_INLINE unsigned builtin_atomic_CAS(unsigned volatile *acc,
   return RAJA::util::reinterp_A_as_B<long, unsigned>(old);
 }
 
-RAJA_DEVICE_HIP
-RAJA_INLINE unsigned long long builtin_atomic_CAS(
+template <typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE unsigned long long builtin_atomic_CAS(
+    Order,
     unsigned long long volatile *acc,
     unsigned long long compare,
     unsigned long long value)
@@ -75,49 +84,213 @@ RAJA_INLINE unsigned long long builtin_atomic_CAS(
   return RAJA::util::reinterp_A_as_B<long long, unsigned long long>(old);
 }
 
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_load(Order, T volatile *acc)
+{
+  T value = *acc;
+  memory_order_fence<Order>::after();
+  return value;
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE void builtin_atomic_store(Order,
+                                                      T volatile *acc,
+                                                      T value)
+{
+  memory_order_fence<Order>::before();
+  *acc = value;
+}
+
 #else  // RAJA_COMPILER_MSVC
 
-RAJA_DEVICE_HIP
-RAJA_INLINE unsigned builtin_atomic_CAS(unsigned volatile *acc,
-                                        unsigned compare,
-                                        unsigned value)
+/*!
+ * The __ATOMIC_XXX orders used for each memory order. Read-modify-write
+ * operations use rmw, or failure when a compare and swap fails; loads and
+ * stores use the strongest order valid for them.
+ *
+ * memory_order_default keeps the acq_rel compare and swap this policy has
+ * always used.
+ */
+template <typename Order>
+struct builtin_memory_order;
+
+template <>
+struct builtin_memory_order<memory_order_default> {
+  static constexpr int rmw = __ATOMIC_ACQ_REL;
+  static constexpr int failure = __ATOMIC_RELAXED;
+  static constexpr int load = __ATOMIC_RELAXED;
+  static constexpr int store = __ATOMIC_RELAXED;
+};
+
+template <>
+struct builtin_memory_order<memory_order_relaxed> {
+  static constexpr int rmw = __ATOMIC_RELAXED;
+  static constexpr int failure = __ATOMIC_RELAXED;
+  static constexpr int load = __ATOMIC_RELAXED;
+  static constexpr int store = __ATOMIC_RELAXED;
+};
+
+template <>
+struct builtin_memory_order<memory_order_acquire> {
+  static constexpr int rmw = __ATOMIC_ACQUIRE;
+  static constexpr int failure = __ATOMIC_ACQUIRE;
+  static constexpr int load = __ATOMIC_ACQUIRE;
+  static constexpr int store = __ATOMIC_RELAXED;
+};
+
+template <>
+struct builtin_memory_order<memory_order_release> {
+  static constexpr int rmw = __ATOMIC_RELEASE;
+  static constexpr int failure = __ATOMIC_RELAXED;
+  static constexpr int load = __ATOMIC_RELAXED;
+  static constexpr int store = __ATOMIC_RELEASE;
+};
+
+template <>
+struct builtin_memory_order<memory_order_acq_rel> {
+  static constexpr int rmw = __ATOMIC_ACQ_REL;
+  static constexpr int failure = __ATOMIC_ACQUIRE;
+  static constexpr int load = __ATOMIC_ACQUIRE;
+  static constexpr int store = __ATOMIC_RELEASE;
+};
+
+template <>
+struct builtin_memory_order<memory_order_seq_cst> {
+  static constexpr int rmw = __ATOMIC_SEQ_CST;
+  static constexpr int failure = __ATOMIC_SEQ_CST;
+  static constexpr int load = __ATOMIC_SEQ_CST;
+  static constexpr int store = __ATOMIC_SEQ_CST;
+};
+
+template <typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE unsigned builtin_atomic_CAS(Order,
+                                                        unsigned volatile *acc,
+                                                        unsigned compare,
+                                                        unsigned value)
 {
-  __atomic_compare_exchange_n(
-      acc, &compare, value, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+  __atomic_compare_exchange_n(acc,
+                              &compare,
+                              value,
+                              false,
+                              builtin_memory_order<Order>::rmw,
+                              builtin_memory_order<Order>::failure);
   return compare;
 }
 
-RAJA_DEVICE_HIP
-RAJA_INLINE unsigned long long builtin_atomic_CAS(
+template <typename Order>
+RAJA_DEVICE_HIP RAJA_INLINE unsigned long long builtin_atomic_CAS(
+    Order,
     unsigned long long volatile *acc,
     unsigned long long compare,
     unsigned long long value)
 {
-  __atomic_compare_exchange_n(
-      acc, &compare, value, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+  __atomic_compare_exchange_n(acc,
+                              &compare,
+                              value,
+                              false,
+                              builtin_memory_order<Order>::rmw,
+                              builtin_memory_order<Order>::failure);
   return compare;
 }
 
+//
+// Unsigned type of each size the __atomic load and store builtins take
+//
+template <size_t BYTES>
+struct builtin_atomic_word {
+  static constexpr bool value = false;
+};
+
+template <>
+struct builtin_atomic_word<sizeof(unsigned char)> {
+  static constexpr bool value = true;
+  using type = unsigned char;
+};
+
+template <>
+struct builtin_atomic_word<sizeof(unsigned short)> {
+  static constexpr bool value = true;
+  using type = unsigned short;
+};
+
+template <>
+struct builtin_atomic_word<sizeof(unsigned)> {
+  static constexpr bool value = true;
+  using type = unsigned;
+};
+
+template <>
+struct builtin_atomic_word<sizeof(unsigned long long)> {
+  static constexpr bool value = true;
+  using type = unsigned long long;
+};
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<builtin_atomic_word<sizeof(T)>::value, T>::type
+    builtin_atomic_load(Order, T volatile *acc)
+{
+  using word = typename builtin_atomic_word<sizeof(T)>::type;
+  return RAJA::util::reinterp_A_as_B<word, T>(__atomic_load_n(
+      (word volatile *)acc, builtin_memory_order<Order>::load));
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<builtin_atomic_word<sizeof(T)>::value>::type
+    builtin_atomic_store(Order, T volatile *acc, T value)
+{
+  using word = typename builtin_atomic_word<sizeof(T)>::type;
+  __atomic_store_n((word volatile *)acc,
+                   RAJA::util::reinterp_A_as_B<T, word>(value),
+                   builtin_memory_order<Order>::store);
+}
+
+//
+// Other sizes are read and written with volatile accesses and fences, as
+// on MSVC
+//
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<!builtin_atomic_word<sizeof(T)>::value, T>::type
+    builtin_atomic_load(Order, T volatile *acc)
+{
+  T value = *acc;
+  memory_order_fence<Order>::after();
+  return value;
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE
+    typename std::enable_if<!builtin_atomic_word<sizeof(T)>::value>::type
+    builtin_atomic_store(Order, T volatile *acc, T value)
+{
+  memory_order_fence<Order>::before();
+  *acc = value;
+}
+
 #endif  // RAJA_COMPILER_MSVC
 
 
-template <typename T>
+template <typename Order, typename T>
 RAJA_DEVICE_HIP RAJA_INLINE
     typename std::enable_if<sizeof(T) == sizeof(unsigned), T>::type
-    builtin_atomic_CAS(T volatile *acc, T compare, T value)
+    builtin_atomic_CAS(Order, T volatile *acc, T compare, T value)
 {
   return RAJA::util::reinterp_A_as_B<unsigned, T>(
-      builtin_atomic_CAS((unsigned volatile *)acc,
+      builtin_atomic_CAS(Order{},
+                         (unsigned volatile *)acc,
                          RAJA::util::reinterp_A_as_B<T, unsigned>(compare),
                          RAJA::util::reinterp_A_as_B<T, unsigned>(value)));
 }
 
-template <typename T>
+template <typename Order, typename T>
 RAJA_DEVICE_HIP RAJA_INLINE
     typename std::enable_if<sizeof(T) == sizeof(unsigned long long), T>::type
-    builtin_atomic_CAS(T volatile *acc, T compare, T value)
+    builtin_atomic_CAS(Order, T volatile *acc, T compare, T value)
 {
   return RAJA::util::reinterp_A_as_B<unsigned long long, T>(builtin_atomic_CAS(
+      Order{},
       (unsigned long long volatile *)acc,
       RAJA::util::reinterp_A_as_B<T, unsigned long long>(compare),
       RAJA::util::reinterp_A_as_B<T, unsigned long long>(value)));
@@ -141,8 +314,9 @@ struct BuiltinAtomicCAS<4> {
    * Implementation uses the existing builtin unsigned 32-bit CAS operator.
    * Returns the OLD value that was replaced by the result of this operation.
    */
-  template <typename T, typename OPER, typename ShortCircuit>
-  RAJA_DEVICE_HIP RAJA_INLINE T operator()(T volatile *acc,
+  template <typename Order, typename T, typename OPER, typename ShortCircuit>
+  RAJA_DEVICE_HIP RAJA_INLINE T operator()(Order,
+                                           T volatile *acc,
                                            OPER const &oper,
                                            ShortCircuit const &sc) const
   {
@@ -155,8 +329,8 @@ struct BuiltinAtomicCAS<4> {
     newval = RAJA::util::reinterp_A_as_B<T, unsigned>(
         oper(RAJA::util::reinterp_A_as_B<unsigned, T>(oldval)));
 
-    while ((readback = builtin_atomic_CAS((unsigned *)acc, oldval, newval)) !=
-           oldval) {
+    while ((readback = builtin_atomic_CAS(
+                Order{}, (unsigned *)acc, oldval, newval)) != oldval) {
       if (sc(readback)) break;
       oldval = readback;
       newval = RAJA::util::reinterp_A_as_B<T, unsigned>(
@@ -177,8 +351,9 @@ struct BuiltinAtomicCAS<8> {
    * Implementation uses the existing builtin unsigned 64-bit CAS operator.
    * Returns the OLD value that was replaced by the result of this operation.
    */
-  template <typename T, typename OPER, typename ShortCircuit>
-  RAJA_DEVICE_HIP RAJA_INLINE T operator()(T volatile *acc,
+  template <typename Order, typename T, typename OPER, typename ShortCircuit>
+  RAJA_DEVICE_HIP RAJA_INLINE T operator()(Order,
+                                           T volatile *acc,
                                            OPER const &oper,
                                            ShortCircuit const &sc) const
   {
@@ -191,7 +366,8 @@ struct BuiltinAtomicCAS<8> {
     newval = RAJA::util::reinterp_A_as_B<T, unsigned long long>(
         oper(RAJA::util::reinterp_A_as_B<unsigned long long, T>(oldval)));
 
-    while ((readback = builtin_atomic_CAS((unsigned long long *)acc,
+    while ((readback = builtin_atomic_CAS(Order{},
+                                          (unsigned long long *)acc,
                                           oldval,
                                           newval)) != oldval) {
       if (sc(readback)) break;
@@ -215,33 +391,305 @@ struct BuiltinAtomicCAS<8> {
  * Implementation uses the builtin unsigned 32-bit and 64-bit CAS operators.
  * Returns the OLD value that was replaced by the result of this operation.
  */
-template <typename T, typename OPER>
-RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_CAS_oper(T volatile *acc,
+template <typename Order, typename T, typename OPER>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_CAS_oper(Order,
+                                                      T volatile *acc,
                                                       OPER &&oper)
 {
   BuiltinAtomicCAS<sizeof(T)> cas;
-  return cas(acc, std::forward<OPER>(oper), [](T const &) { return false; });
+  return cas(Order{}, acc, std::forward<OPER>(oper), [](T const &) {
+    return false;
+  });
 }
 
-template <typename T, typename OPER, typename ShortCircuit>
-RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_CAS_oper_sc(T volatile *acc,
+template <typename Order, typename T, typename OPER, typename ShortCircuit>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_CAS_oper_sc(Order,
+                                                         T volatile *acc,
                                                          OPER &&oper,
                                                          ShortCircuit const &sc)
 {
   BuiltinAtomicCAS<sizeof(T)> cas;
-  return cas(acc, std::forward<OPER>(oper), sc);
+  return cas(Order{}, acc, std::forward<OPER>(oper), sc);
+}
+
+
+/*!
+ * Integral add, sub, and, or, xor and exchange map directly onto the
+ * __atomic_fetch_XXX routines; everything else is a compare and swap loop.
+ */
+template <typename T>
+struct builtin_atomic_fetch_native
+#if defined(RAJA_COMPILER_MSVC) || (defined(_WIN32) && defined(__INTEL_COMPILER))
+    : std::false_type {
+#else
+    : std::integral_constant<bool,
+                             std::is_integral<T>::value &&
+                                 !std::is_same<T, bool>::value> {
+#endif
+};
+
+#if !(defined(RAJA_COMPILER_MSVC) || (defined(_WIN32) && defined(__INTEL_COMPILER)))
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_add(Order,
+                                                       T volatile *acc,
+                                                       T value,
+                                                       std::true_type)
+{
+  return __atomic_fetch_add(acc, value, builtin_memory_order<Order>::rmw);
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_sub(Order,
+                                                       T volatile *acc,
+                                                       T value,
+                                                       std::true_type)
+{
+  return __atomic_fetch_sub(acc, value, builtin_memory_order<Order>::rmw);
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_and(Order,
+                                                       T volatile *acc,
+                                                       T value,
+                                                       std::true_type)
+{
+  return __atomic_fetch_and(acc, value, builtin_memory_order<Order>::rmw);
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_or(Order,
+                                                      T volatile *acc,
+                                                      T value,
+                                                      std::true_type)
+{
+  return __atomic_fetch_or(acc, value, builtin_memory_order<Order>::rmw);
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_xor(Order,
+                                                       T volatile *acc,
+                                                       T value,
+                                                       std::true_type)
+{
+  return __atomic_fetch_xor(acc, value, builtin_memory_order<Order>::rmw);
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_exchange(Order,
+                                                      T volatile *acc,
+                                                      T value,
+                                                      std::true_type)
+{
+  return __atomic_exchange_n(acc, value, builtin_memory_order<Order>::rmw);
+}
+
+#endif
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_add(Order,
+                                                       T volatile *acc,
+                                                       T value,
+                                                       std::false_type)
+{
+  return builtin_atomic_CAS_oper(Order{}, acc, [=](T a) { return a + value; });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_sub(Order,
+                                                       T volatile *acc,
+                                                       T value,
+                                                       std::false_type)
+{
+  return builtin_atomic_CAS_oper(Order{}, acc, [=](T a) { return a - value; });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_and(Order,
+                                                       T volatile *acc,
+                                                       T value,
+                                                       std::false_type)
+{
+  return builtin_atomic_CAS_oper(Order{}, acc, [=](T a) { return a & value; });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_or(Order,
+                                                      T volatile *acc,
+                                                      T value,
+                                                      std::false_type)
+{
+  return builtin_atomic_CAS_oper(Order{}, acc, [=](T a) { return a | value; });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_xor(Order,
+                                                       T volatile *acc,
+                                                       T value,
+                                                       std::false_type)
+{
+  return builtin_atomic_CAS_oper(Order{}, acc, [=](T a) { return a ^ value; });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_exchange(Order,
+                                                      T volatile *acc,
+                                                      T value,
+                                                      std::false_type)
+{
+  return builtin_atomic_CAS_oper(Order{}, acc, [=](T) { return value; });
 }
 
 
 }  // namespace detail
 
 
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicLoad(builtin_atomic, Order, T volatile *acc)
+{
+  return detail::builtin_atomic_load(Order{}, acc);
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicStore(builtin_atomic, Order, T volatile *acc, T value)
+{
+  detail::builtin_atomic_store(Order{}, acc, value);
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicAdd(builtin_atomic, Order, T volatile *acc, T value)
+{
+  return detail::builtin_atomic_fetch_add(
+      Order{}, acc, value, detail::builtin_atomic_fetch_native<T>{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicSub(builtin_atomic, Order, T volatile *acc, T value)
+{
+  return detail::builtin_atomic_fetch_sub(
+      Order{}, acc, value, detail::builtin_atomic_fetch_native<T>{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicMin(builtin_atomic, Order, T volatile *acc, T value)
+{
+  T current = detail::builtin_atomic_load(Order{}, acc);
+  if (current < value) {
+    return current;
+  }
+  return detail::builtin_atomic_CAS_oper_sc(Order{},
+                                            acc,
+                                            [=](T a) {
+                                              return a < value ? a : value;
+                                            },
+                                            [=](T current) {
+                                              return current < value;
+                                            });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicMax(builtin_atomic, Order, T volatile *acc, T value)
+{
+  T current = detail::builtin_atomic_load(Order{}, acc);
+  if (current > value) {
+    return current;
+  }
+  return detail::builtin_atomic_CAS_oper_sc(Order{},
+                                            acc,
+                                            [=](T a) {
+                                              return a > value ? a : value;
+                                            },
+                                            [=](T current) {
+                                              return current > value;
+                                            });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicInc(builtin_atomic, Order, T volatile *acc)
+{
+  return detail::builtin_atomic_fetch_add(
+      Order{}, acc, T(1), detail::builtin_atomic_fetch_native<T>{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicInc(builtin_atomic, Order, T volatile *acc, T val)
+{
+  return detail::builtin_atomic_CAS_oper(Order{}, acc, [=](T old) {
+    return ((old >= val) ? 0 : (old + 1));
+  });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicDec(builtin_atomic, Order, T volatile *acc)
+{
+  return detail::builtin_atomic_fetch_sub(
+      Order{}, acc, T(1), detail::builtin_atomic_fetch_native<T>{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicDec(builtin_atomic, Order, T volatile *acc, T val)
+{
+  return detail::builtin_atomic_CAS_oper(Order{}, acc, [=](T old) {
+    return (((old == 0) | (old > val)) ? val : (old - 1));
+  });
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicAnd(builtin_atomic, Order, T volatile *acc, T value)
+{
+  return detail::builtin_atomic_fetch_and(
+      Order{}, acc, value, detail::builtin_atomic_fetch_native<T>{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicOr(builtin_atomic, Order, T volatile *acc, T value)
+{
+  return detail::builtin_atomic_fetch_or(
+      Order{}, acc, value, detail::builtin_atomic_fetch_native<T>{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicXor(builtin_atomic, Order, T volatile *acc, T value)
+{
+  return detail::builtin_atomic_fetch_xor(
+      Order{}, acc, value, detail::builtin_atomic_fetch_native<T>{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicExchange(builtin_atomic, Order, T volatile *acc, T value)
+{
+  return detail::builtin_atomic_exchange(
+      Order{}, acc, value, detail::builtin_atomic_fetch_native<T>{});
+}
+
+template <typename Order, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicCAS(builtin_atomic, Order, T volatile *acc, T compare, T value)
+{
+  return detail::builtin_atomic_CAS(Order{}, acc, compare, value);
+}
+
+
 template <typename T>
 RAJA_DEVICE_HIP RAJA_INLINE T atomicAdd(builtin_atomic,
                                         T volatile *acc,
                                         T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+  return atomicAdd(builtin_atomic{}, memory_order_default{}, acc, value);
 }
 
 
@@ -250,7 +698,7 @@ RAJA_DEVICE_HIP RAJA_INLINE T atomicSub(builtin_atomic,
                                         T volatile *acc,
                                         T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a - value; });
+  return atomicSub(builtin_atomic{}, memory_order_default{}, acc, value);
 }
 
 template <typename T>
@@ -258,16 +706,7 @@ RAJA_DEVICE_HIP RAJA_INLINE T atomicMin(builtin_atomic,
                                         T volatile *acc,
                                         T value)
 {
-  if (*acc < value) {
-    return *acc;
-  }
-  return detail::builtin_atomic_CAS_oper_sc(acc,
-                                            [=](T a) {
-                                              return a < value ? a : value;
-                                            },
-                                            [=](T current) {
-                                              return current < value;
-                                            });
+  return atomicMin(builtin_atomic{}, memory_order_default{}, acc, value);
 }
 
 template <typename T>
@@ -275,44 +714,31 @@ RAJA_DEVICE_HIP RAJA_INLINE T atomicMax(builtin_atomic,
                                         T volatile *acc,
                                         T value)
 {
-  if (*acc > value) {
-    return *acc;
-  }
-  return detail::builtin_atomic_CAS_oper_sc(acc,
-                                            [=](T a) {
-                                              return a > value ? a : value;
-                                            },
-                                            [=](T current) {
-                                              return current > value;
-                                            });
+  return atomicMax(builtin_atomic{}, memory_order_default{}, acc, value);
 }
 
 template <typename T>
 RAJA_DEVICE_HIP RAJA_INLINE T atomicInc(builtin_atomic, T volatile *acc)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a + 1; });
+  return atomicInc(builtin_atomic{}, memory_order_default{}, acc);
 }
 
 template <typename T>
 RAJA_DEVICE_HIP RAJA_INLINE T atomicInc(builtin_atomic, T volatile *acc, T val)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T old) {
-    return ((old >= val) ? 0 : (old + 1));
-  });
+  return atomicInc(builtin_atomic{}, memory_order_default{}, acc, val);
 }
 
 template <typename T>
 RAJA_DEVICE_HIP RAJA_INLINE T atomicDec(builtin_atomic, T volatile *acc)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a - 1; });
+  return atomicDec(builtin_atomic{}, memory_order_default{}, acc);
 }
 
 template <typename T>
 RAJA_DEVICE_HIP RAJA_INLINE T atomicDec(builtin_atomic, T volatile *acc, T val)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T old) {
-    return (((old == 0) | (old > val)) ? val : (old - 1));
-  });
+  return atomicDec(builtin_atomic{}, memory_order_default{}, acc, val);
 }
 
 template <typename T>
@@ -320,13 +746,13 @@ RAJA_DEVICE_HIP RAJA_INLINE T atomicAnd(builtin_atomic,
                                         T volatile *acc,
                                         T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a & value; });
+  return atomicAnd(builtin_atomic{}, memory_order_default{}, acc, value);
 }
 
 template <typename T>
 RAJA_DEVICE_HIP RAJA_INLINE T atomicOr(builtin_atomic, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a | value; });
+  return atomicOr(builtin_atomic{}, memory_order_default{}, acc, value);
 }
 
 template <typename T>
@@ -334,7 +760,7 @@ RAJA_DEVICE_HIP RAJA_INLINE T atomicXor(builtin_atomic,
                                         T volatile *acc,
                                         T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a ^ value; });
+  return atomicXor(builtin_atomic{}, memory_order_default{}, acc, value);
 }
 
 template <typename T>
@@ -342,14 +768,14 @@ RAJA_DEVICE_HIP RAJA_INLINE T atomicExchange(builtin_atomic,
                                              T volatile *acc,
                                              T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T) { return value; });
+  return atomicExchange(builtin_atomic{}, memory_order_default{}, acc, value);
 }
 
 template <typename T>
 RAJA_DEVICE_HIP RAJA_INLINE T
 atomicCAS(builtin_atomic, T volatile *acc, T compare, T value)
 {
-  return detail::builtin_atomic_CAS(acc, compare, value);
+  return atomicCAS(builtin_atomic{}, memory_order_default{}, acc, compare, value);
 }
 
 
@@ -0,0 +1,471 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the combining atomic policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_combining_HPP
+#define RAJA_policy_atomic_combining_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "RAJA/policy/atomic_auto.hpp"
+#include "RAJA/policy/atomic_order.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Host atomic policy for heavily contended locations.
+ *
+ * Updates are combined in a small table of per-thread slots and applied to
+ * memory with one atomic of the underlying Policy per slot when the slot is
+ * evicted or the updates are flushed. Only add, sub, inc, dec, min and max
+ * are combined; the other operations flush all pending updates and then use
+ * Policy directly.
+ *
+ * A thread updates its own slots without locks or atomics, so the updates
+ * of other threads are only applied by an explicit flush, which is
+ * required: RAJA::flush_combining_atomics(), or the end of a
+ * RAJA::combining_atomic_scope, applies the pending updates of all threads
+ * and must be called when no other thread is making combined updates, such
+ * as after the loop that made them. RAJA::atomicLoad and RAJA::atomicStore,
+ * which AtomicRef uses for its loads and stores, and the operations that are
+ * not combined only flush the updates of the calling thread; the updates of
+ * a thread are also applied when it exits. Updates of different kinds to one
+ * location, such as adds and maxima, are applied in no particular order
+ * between flushes.
+ *
+ * Since updates are deferred, there is no value immediately before a
+ * combined update to return: atomicAdd, atomicSub, atomicMin, atomicMax and
+ * the unbounded atomicInc and atomicDec return void with this policy, so
+ * code using their result does not compile. Memory orders given to them
+ * have no effect.
+ *
+ * Updates must be flushed before the memory they target is released.
+ */
+template <typename Policy = auto_atomic>
+struct combining_atomic {
+};
+
+namespace detail
+{
+
+/*!
+ * Result of the atomic operations that combining_atomic defers: the value
+ * before the update for every other policy, and void for combining_atomic.
+ */
+template <typename Policy, typename T>
+struct atomic_update_result {
+  using type = T;
+};
+
+template <typename Policy, typename T>
+struct atomic_update_result<combining_atomic<Policy>, T> {
+  using type = void;
+};
+
+template <typename Policy, typename T>
+using atomic_update_result_t = typename atomic_update_result<Policy, T>::type;
+
+class CombiningTableBase
+{
+public:
+  virtual void flush() = 0;
+
+protected:
+  ~CombiningTableBase() = default;
+};
+
+//
+// All combining tables of all threads, so any thread can flush them
+//
+struct CombiningRegistry {
+  std::mutex mutex;
+  std::vector<CombiningTableBase *> tables;
+
+  static CombiningRegistry &get()
+  {
+    static CombiningRegistry registry;
+    return registry;
+  }
+};
+
+//
+// The combining tables of the calling thread, one per value type and policy
+//
+struct CombiningThreadTables {
+  std::vector<CombiningTableBase *> tables;
+
+  static CombiningThreadTables &get()
+  {
+    static thread_local CombiningThreadTables thread_tables;
+    return thread_tables;
+  }
+};
+
+enum class CombiningOp : int { none, add, min, max };
+
+/*!
+ * Direct-mapped table of pending updates of one thread for one value type
+ * and underlying policy. Only the owning thread updates it; other threads
+ * flush it while the owner makes no updates, under the registry mutex.
+ */
+template <typename T, typename Policy>
+class CombiningTable : public CombiningTableBase
+{
+  static constexpr size_t num_slots = 64;
+
+  struct Slot {
+    T volatile *acc{nullptr};
+    CombiningOp op{CombiningOp::none};
+    T value{};
+  };
+
+public:
+  static CombiningTable &get()
+  {
+    static thread_local CombiningTable table;
+    return table;
+  }
+
+  void update(T volatile *acc, CombiningOp op, T value)
+  {
+    Slot &slot = slots[index(acc, op)];
+    if (slot.acc == acc && slot.op == op) {
+      slot.value = combine(op, slot.value, value);
+    } else {
+      apply(slot);
+      slot.acc = acc;
+      slot.op = op;
+      slot.value = value;
+    }
+  }
+
+  void flush() override
+  {
+    for (size_t i = 0; i < num_slots; ++i) {
+      apply(slots[i]);
+    }
+  }
+
+private:
+  CombiningTable()
+  {
+    CombiningThreadTables::get().tables.push_back(this);
+
+    CombiningRegistry &registry = CombiningRegistry::get();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    registry.tables.push_back(this);
+  }
+
+  // Pending updates of an exiting thread are applied before the table is
+  // unregistered, so no update is lost when a worker thread ends; the
+  // thread's table list was constructed first, so it is still alive here
+  ~CombiningTable()
+  {
+    std::vector<CombiningTableBase *> &own =
+        CombiningThreadTables::get().tables;
+    own.erase(std::remove(own.begin(), own.end(), this), own.end());
+
+    CombiningRegistry &registry = CombiningRegistry::get();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    flush();
+    registry.tables.erase(std::remove(registry.tables.begin(),
+                                      registry.tables.end(),
+                                      this),
+                          registry.tables.end());
+  }
+
+  static size_t index(T volatile *acc, CombiningOp op)
+  {
+    uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(acc)) ^
+                   static_cast<uint64_t>(op);
+    key *= 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(key >> 58);
+  }
+
+  static T combine(CombiningOp op, T a, T b)
+  {
+    switch (op) {
+      case CombiningOp::min:
+        return a < b ? a : b;
+      case CombiningOp::max:
+        return a > b ? a : b;
+      default:
+        return a + b;
+    }
+  }
+
+  static void apply(Slot &slot)
+  {
+    switch (slot.op) {
+      case CombiningOp::add:
+        RAJA::atomicAdd(Policy{}, slot.acc, slot.value);
+        break;
+      case CombiningOp::min:
+        RAJA::atomicMin(Policy{}, slot.acc, slot.value);
+        break;
+      case CombiningOp::max:
+        RAJA::atomicMax(Policy{}, slot.acc, slot.value);
+        break;
+      default:
+        break;
+    }
+    slot.acc = nullptr;
+    slot.op = CombiningOp::none;
+  }
+
+  Slot slots[num_slots];
+};
+
+/*!
+ * Applies the pending combining_atomic updates of the calling thread.
+ */
+RAJA_INLINE void flush_thread_combining_atomics()
+{
+  for (CombiningTableBase *table : CombiningThreadTables::get().tables) {
+    table->flush();
+  }
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Applies the pending combining_atomic updates of all threads.
+ *
+ * No other thread may make combined updates during the flush; call it
+ * after the loops making them have completed.
+ */
+RAJA_INLINE void flush_combining_atomics()
+{
+  detail::CombiningRegistry &registry = detail::CombiningRegistry::get();
+  std::lock_guard<std::mutex> guard(registry.mutex);
+  for (detail::CombiningTableBase *table : registry.tables) {
+    table->flush();
+  }
+}
+
+/*!
+ * \brief Flushes combining_atomic updates at the end of a scope.
+ *
+ * \code
+ *
+ * {
+ *   RAJA::combining_atomic_scope scope;
+ *   RAJA::forall<RAJA::omp_parallel_for_exec>(seg, [=](int i) {
+ *     RAJA::atomicAdd<RAJA::combining_atomic<>>(&hist[bin(i)], 1);
+ *   });
+ * }  // all updates to hist are visible here
+ *
+ * \endcode
+ */
+class combining_atomic_scope
+{
+public:
+  combining_atomic_scope() = default;
+
+  combining_atomic_scope(combining_atomic_scope const &) = delete;
+  combining_atomic_scope &operator=(combining_atomic_scope const &) = delete;
+
+  ~combining_atomic_scope() { flush_combining_atomics(); }
+};
+
+namespace detail
+{
+
+//! Combined updates are unordered until they are flushed
+template <typename Policy, typename Order>
+struct atomic_order_fence<combining_atomic<Policy>, Order>
+    : memory_order_fence<memory_order_relaxed> {
+};
+
+}  // namespace detail
+
+
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicLoad(combining_atomic<Policy>, Order, T volatile *acc)
+{
+  detail::flush_thread_combining_atomics();
+  detail::atomic_order_fence<Policy, Order>::before();
+  T value = *acc;
+  detail::atomic_order_fence<Policy, Order>::after();
+  return value;
+}
+
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicStore(combining_atomic<Policy>, Order, T volatile *acc, T value)
+{
+  detail::flush_thread_combining_atomics();
+  detail::atomic_order_fence<Policy, Order>::before();
+  *acc = value;
+  detail::atomic_order_fence<Policy, Order>::after();
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicAdd(combining_atomic<Policy>, T volatile *acc, T value)
+{
+  detail::CombiningTable<T, Policy>::get().update(acc,
+                                                  detail::CombiningOp::add,
+                                                  value);
+}
+
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicAdd(combining_atomic<Policy> pol, Order, T volatile *acc, T value)
+{
+  RAJA::atomicAdd(pol, acc, value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicSub(combining_atomic<Policy>, T volatile *acc, T value)
+{
+  detail::CombiningTable<T, Policy>::get().update(acc,
+                                                  detail::CombiningOp::add,
+                                                  T(0) - value);
+}
+
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicSub(combining_atomic<Policy> pol, Order, T volatile *acc, T value)
+{
+  RAJA::atomicSub(pol, acc, value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicMin(combining_atomic<Policy>, T volatile *acc, T value)
+{
+  detail::CombiningTable<T, Policy>::get().update(acc,
+                                                  detail::CombiningOp::min,
+                                                  value);
+}
+
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicMin(combining_atomic<Policy> pol, Order, T volatile *acc, T value)
+{
+  RAJA::atomicMin(pol, acc, value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicMax(combining_atomic<Policy>, T volatile *acc, T value)
+{
+  detail::CombiningTable<T, Policy>::get().update(acc,
+                                                  detail::CombiningOp::max,
+                                                  value);
+}
+
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicMax(combining_atomic<Policy> pol, Order, T volatile *acc, T value)
+{
+  RAJA::atomicMax(pol, acc, value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicInc(combining_atomic<Policy>, T volatile *acc)
+{
+  detail::CombiningTable<T, Policy>::get().update(acc,
+                                                  detail::CombiningOp::add,
+                                                  T(1));
+}
+
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicInc(combining_atomic<Policy> pol, Order, T volatile *acc)
+{
+  RAJA::atomicInc(pol, acc);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicDec(combining_atomic<Policy>, T volatile *acc)
+{
+  detail::CombiningTable<T, Policy>::get().update(acc,
+                                                  detail::CombiningOp::add,
+                                                  T(0) - T(1));
+}
+
+template <typename Policy, typename Order, typename T>
+RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicDec(combining_atomic<Policy> pol, Order, T volatile *acc)
+{
+  RAJA::atomicDec(pol, acc);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE T atomicInc(combining_atomic<Policy>, T volatile *acc, T compare)
+{
+  detail::flush_thread_combining_atomics();
+  return RAJA::atomicInc(Policy{}, acc, compare);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE T atomicDec(combining_atomic<Policy>, T volatile *acc, T compare)
+{
+  detail::flush_thread_combining_atomics();
+  return RAJA::atomicDec(Policy{}, acc, compare);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE T atomicAnd(combining_atomic<Policy>, T volatile *acc, T value)
+{
+  detail::flush_thread_combining_atomics();
+  return RAJA::atomicAnd(Policy{}, acc, value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE T atomicOr(combining_atomic<Policy>, T volatile *acc, T value)
+{
+  detail::flush_thread_combining_atomics();
+  return RAJA::atomicOr(Policy{}, acc, value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE T atomicXor(combining_atomic<Policy>, T volatile *acc, T value)
+{
+  detail::flush_thread_combining_atomics();
+  return RAJA::atomicXor(Policy{}, acc, value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE T atomicExchange(combining_atomic<Policy>,
+                             T volatile *acc,
+                             T value)
+{
+  detail::flush_thread_combining_atomics();
+  return RAJA::atomicExchange(Policy{}, acc, value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE T atomicCAS(combining_atomic<Policy>,
+                        T volatile *acc,
+                        T compare,
+                        T value)
+{
+  detail::flush_thread_combining_atomics();
+  return RAJA::atomicCAS(Policy{}, acc, compare, value);
+}
+
+}  // namespace RAJA
+
+#endif
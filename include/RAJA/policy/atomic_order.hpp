@@ -0,0 +1,153 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining memory orders for atomic operations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_order_HPP
+#define RAJA_policy_atomic_order_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Memory orders for atomic operations, with the meaning of the matching
+ * std::memory_order. memory_order_default keeps the ordering the atomic
+ * policy provides when no order is given.
+ */
+struct memory_order_default {
+};
+struct memory_order_relaxed {
+};
+struct memory_order_acquire {
+};
+struct memory_order_release {
+};
+struct memory_order_acq_rel {
+};
+struct memory_order_seq_cst {
+};
+
+namespace detail
+{
+
+template <typename Order>
+struct is_memory_order : std::false_type {
+};
+
+template <>
+struct is_memory_order<memory_order_default> : std::true_type {
+};
+template <>
+struct is_memory_order<memory_order_relaxed> : std::true_type {
+};
+template <>
+struct is_memory_order<memory_order_acquire> : std::true_type {
+};
+template <>
+struct is_memory_order<memory_order_release> : std::true_type {
+};
+template <>
+struct is_memory_order<memory_order_acq_rel> : std::true_type {
+};
+template <>
+struct is_memory_order<memory_order_seq_cst> : std::true_type {
+};
+
+template <typename Order, typename T>
+using enable_if_memory_order =
+    typename std::enable_if<is_memory_order<Order>::value, T>::type;
+
+RAJA_INLINE RAJA_HOST_DEVICE void atomic_fence_acquire()
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  __threadfence();
+#else
+  std::atomic_thread_fence(std::memory_order_acquire);
+#endif
+}
+
+RAJA_INLINE RAJA_HOST_DEVICE void atomic_fence_release()
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  __threadfence();
+#else
+  std::atomic_thread_fence(std::memory_order_release);
+#endif
+}
+
+RAJA_INLINE RAJA_HOST_DEVICE void atomic_fence_seq_cst()
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  __threadfence();
+#else
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+//
+// Fences that turn a relaxed atomic operation into one with the given order
+//
+template <typename Order>
+struct memory_order_fence {
+  RAJA_INLINE RAJA_HOST_DEVICE static void before() {}
+  RAJA_INLINE RAJA_HOST_DEVICE static void after() {}
+};
+
+template <>
+struct memory_order_fence<memory_order_acquire> {
+  RAJA_INLINE RAJA_HOST_DEVICE static void before() {}
+  RAJA_INLINE RAJA_HOST_DEVICE static void after() { atomic_fence_acquire(); }
+};
+
+template <>
+struct memory_order_fence<memory_order_release> {
+  RAJA_INLINE RAJA_HOST_DEVICE static void before() { atomic_fence_release(); }
+  RAJA_INLINE RAJA_HOST_DEVICE static void after() {}
+};
+
+template <>
+struct memory_order_fence<memory_order_acq_rel> {
+  RAJA_INLINE RAJA_HOST_DEVICE static void before() { atomic_fence_release(); }
+  RAJA_INLINE RAJA_HOST_DEVICE static void after() { atomic_fence_acquire(); }
+};
+
+template <>
+struct memory_order_fence<memory_order_seq_cst> {
+  RAJA_INLINE RAJA_HOST_DEVICE static void before() { atomic_fence_seq_cst(); }
+  RAJA_INLINE RAJA_HOST_DEVICE static void after() { atomic_fence_seq_cst(); }
+};
+
+/*!
+ * Fences placed around the operations of an atomic policy that has no
+ * ordered implementation of its own. Policies whose operations never run
+ * concurrently, or are ordered some other way, specialize this to use
+ * memory_order_fence<memory_order_relaxed>, which does nothing.
+ */
+template <typename Policy, typename Order>
+struct atomic_order_fence : memory_order_fence<Order> {
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -37,6 +37,11 @@ __global__ void launch_global_fcn(LaunchContext ctx, BODY body_in)
   using RAJA::internal::thread_privatize;
   auto privatizer = thread_privatize(body_in);
   auto& body = privatizer.get_priv();
+
+  // team scratch memory requested through the Grid
+  extern __shared__ char raja_team_shmem[];
+  ctx.shared_mem_ptr = raja_team_shmem;
+
   body(ctx);
 }
 
@@ -74,7 +79,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -130,7 +135,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -162,6 +167,11 @@ __launch_bounds__(num_threads, 1) __global__
   using RAJA::internal::thread_privatize;
   auto privatizer = thread_privatize(body_in);
   auto& body = privatizer.get_priv();
+
+  // team scratch memory requested through the Grid
+  extern __shared__ char raja_team_shmem[];
+  ctx.shared_mem_ptr = raja_team_shmem;
+
   body(ctx);
 }
 
@@ -200,7 +210,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -254,7 +264,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -15,6 +15,7 @@
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_order.hpp"
 
 #include "desul/atomics.hpp"
 
@@ -172,6 +173,224 @@ RAJA_INLINE T atomicCAS(AtomicPolicy, T volatile *acc, T compare, T value)
                                         raja_default_desul_scope{});
 }
 
+
+namespace detail
+{
+
+//! The desul order for each RAJA memory order
+template <typename Order>
+struct desul_memory_order {
+  using type = raja_default_desul_order;
+};
+
+template <>
+struct desul_memory_order<memory_order_relaxed> {
+  using type = desul::MemoryOrderRelaxed;
+};
+
+template <>
+struct desul_memory_order<memory_order_acquire> {
+  using type = desul::MemoryOrderAcquire;
+};
+
+template <>
+struct desul_memory_order<memory_order_release> {
+  using type = desul::MemoryOrderRelease;
+};
+
+template <>
+struct desul_memory_order<memory_order_acq_rel> {
+  using type = desul::MemoryOrderAcqRel;
+};
+
+template <>
+struct desul_memory_order<memory_order_seq_cst> {
+  using type = desul::MemoryOrderSeqCst;
+};
+
+template <typename Order>
+using desul_memory_order_t = typename desul_memory_order<Order>::type;
+
+}  // namespace detail
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicLoad(AtomicPolicy, Order, T volatile *acc)
+{
+  return desul::atomic_load(const_cast<T*>(acc),
+                            detail::desul_memory_order_t<Order>{},
+                            raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, void>
+atomicStore(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  desul::atomic_store(const_cast<T*>(acc),
+                      value,
+                      detail::desul_memory_order_t<Order>{},
+                      raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicAdd(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  return desul::atomic_fetch_add(const_cast<T*>(acc),
+                                 value,
+                                 detail::desul_memory_order_t<Order>{},
+                                 raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicSub(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  return desul::atomic_fetch_sub(const_cast<T*>(acc),
+                                 value,
+                                 detail::desul_memory_order_t<Order>{},
+                                 raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicMin(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  return desul::atomic_fetch_min(const_cast<T*>(acc),
+                                 value,
+                                 detail::desul_memory_order_t<Order>{},
+                                 raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicMax(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  return desul::atomic_fetch_max(const_cast<T*>(acc),
+                                 value,
+                                 detail::desul_memory_order_t<Order>{},
+                                 raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicInc(AtomicPolicy, Order, T volatile *acc)
+{
+  return desul::atomic_fetch_inc(const_cast<T*>(acc),
+                                 detail::desul_memory_order_t<Order>{},
+                                 raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicInc(AtomicPolicy, Order, T volatile *acc, T val)
+{
+  return desul::atomic_wrapping_fetch_inc(const_cast<T*>(acc),
+                                          val,
+                                          detail::desul_memory_order_t<Order>{},
+                                          raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicDec(AtomicPolicy, Order, T volatile *acc)
+{
+  return desul::atomic_fetch_dec(const_cast<T*>(acc),
+                                 detail::desul_memory_order_t<Order>{},
+                                 raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicDec(AtomicPolicy, Order, T volatile *acc, T val)
+{
+  return desul::atomic_wrapping_fetch_dec(const_cast<T*>(acc),
+                                          val,
+                                          detail::desul_memory_order_t<Order>{},
+                                          raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicAnd(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  return desul::atomic_fetch_and(const_cast<T*>(acc),
+                                 value,
+                                 detail::desul_memory_order_t<Order>{},
+                                 raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicOr(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  return desul::atomic_fetch_or(const_cast<T*>(acc),
+                                value,
+                                detail::desul_memory_order_t<Order>{},
+                                raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicXor(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  return desul::atomic_fetch_xor(const_cast<T*>(acc),
+                                 value,
+                                 detail::desul_memory_order_t<Order>{},
+                                 raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicExchange(AtomicPolicy, Order, T volatile *acc, T value)
+{
+  return desul::atomic_exchange(const_cast<T*>(acc),
+                                value,
+                                detail::desul_memory_order_t<Order>{},
+                                raja_default_desul_scope{});
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename AtomicPolicy, typename Order, typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE detail::enable_if_memory_order<Order, T>
+atomicCAS(AtomicPolicy, Order, T volatile *acc, T compare, T value)
+{
+  return desul::atomic_compare_exchange(const_cast<T*>(acc),
+                                        compare,
+                                        value,
+                                        detail::desul_memory_order_t<Order>{},
+                                        raja_default_desul_scope{});
+}
+
 }  // namespace RAJA
 
 #endif  // RAJA_ENABLE_DESUL_ATOMICS
@@ -37,6 +37,11 @@ __global__ void launch_global_fcn(LaunchContext ctx, BODY body_in)
   using RAJA::internal::thread_privatize;
   auto privatizer = thread_privatize(body_in);
   auto& body = privatizer.get_priv();
+
+  // team scratch memory requested through the Grid
+  extern __shared__ char raja_team_shmem[];
+  ctx.shared_mem_ptr = raja_team_shmem;
+
   body(ctx);
 }
 
@@ -74,7 +79,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -127,7 +132,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -158,6 +163,11 @@ static void launch_global_fcn_fixed(LaunchContext ctx, BODY body_in)
   using RAJA::internal::thread_privatize;
   auto privatizer = thread_privatize(body_in);
   auto& body = privatizer.get_priv();
+
+  // team scratch memory requested through the Grid
+  extern __shared__ char raja_team_shmem[];
+  ctx.shared_mem_ptr = raja_team_shmem;
+
   body(ctx);
 }
 
@@ -196,7 +206,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -249,7 +259,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -27,6 +27,9 @@
 
 #include "RAJA/policy/loop/policy.hpp"
 
+#include "RAJA/index/BitmaskSegment.hpp"
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
@@ -65,6 +68,53 @@ RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
   }
   return RAJA::resources::EventProxy<Resource>(res);
 }
+
+//
+// Compressed list segments are decoded one block at a time
+//
+template <typename T, typename Func, typename Resource>
+RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
+                                                    const loop_exec &,
+                                                    TypedCompressedListSegment<T> seg,
+                                                    Func &&body)
+{
+  T block[TypedCompressedListSegment<T>::block_size];
+  const Index_type num_blocks = seg.getNumBlocks();
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type len = seg.decodeBlock(b, block);
+
+    for (Index_type i = 0; i < len; ++i) {
+      body(block[i]);
+    }
+  }
+  return RAJA::resources::EventProxy<Resource>(res);
+}
+
+//
+// Bitmask segments visit the set bits of each word, skipping zero words
+//
+template <typename T, typename Func, typename Resource>
+RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
+                                                    const loop_exec &,
+                                                    TypedBitmaskSegment<T> seg,
+                                                    Func &&body)
+{
+  seg.visitWords(0, seg.getNumWords(), body);
+  return RAJA::resources::EventProxy<Resource>(res);
+}
+
+//
+// Box segments are visited in their traversal order
+//
+template <typename T, size_t N, typename Order, typename Func, typename Resource>
+RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
+                                                    const loop_exec &,
+                                                    TypedBoxSegment<T, N, Order> seg,
+                                                    Func &&body)
+{
+  seg.visit(body);
+  return RAJA::resources::EventProxy<Resource>(res);
+}
 }  // namespace loop
 
 }  // namespace policy
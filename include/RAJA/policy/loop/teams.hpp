@@ -21,6 +21,7 @@
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/sequential/teams.hpp"
 
 
 namespace RAJA
@@ -46,14 +47,18 @@ struct LaunchExecute<RAJA::expt::seq_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    detail::HostTeamSharedMemory shmem(ctx.shared_mem_size);
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shmem.get();
+
+    body(team_ctx);
   }
 
   template <typename BODY>
   static resources::EventProxy<resources::Resource>
   exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    exec(ctx, body);
 
     return resources::EventProxy<resources::Resource>(res);
   }
@@ -244,6 +249,18 @@ struct TileICountExecute<loop_exec, SEGMENT> {
 
 };
 
+//
+// Team reductions and scans carry a loop dependence, so they run sequentially
+//
+template <typename SEGMENT>
+struct LoopReduceExecute<loop_exec, SEGMENT>
+    : LoopReduceExecute<seq_exec, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopScanExecute<loop_exec, SEGMENT> : LoopScanExecute<seq_exec, SEGMENT> {
+};
+
 }  // namespace expt
 
 }  // namespace RAJA
@@ -30,15 +30,20 @@
 
 #include <omp.h>
 
+#include "RAJA/util/affinity_schedule.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/index/BitmaskSegment.hpp"
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
@@ -63,6 +68,7 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   RAJA::region<RAJA::omp_parallel_region>([&]() {
     using RAJA::internal::thread_privatize;
     auto body = thread_privatize(loop_body);
+    PersistentTeamLoop in_loop;
     forall_impl(host_res, InnerPolicy{}, iter, body.get_priv());
   });
   return resources::EventProxy<resources::Host>(host_res);
@@ -298,6 +304,71 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+//
+// Compressed list segments are scheduled by block, and each thread decodes
+// its blocks one at a time
+//
+template <typename Schedule, typename T, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_for_schedule_exec<Schedule>&,
+                                                               TypedCompressedListSegment<T> seg,
+                                                               Func&& loop_body)
+{
+  internal::forall_impl(Schedule{},
+                        TypedRangeSegment<Index_type>(0, seg.getNumBlocks()),
+                        [&](Index_type b) {
+                          T block[TypedCompressedListSegment<T>::block_size];
+                          const Index_type len = seg.decodeBlock(b, block);
+                          for (Index_type i = 0; i < len; ++i) {
+                            loop_body(block[i]);
+                          }
+                        });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+//
+// Bitmask segments are scheduled by word, and each thread visits the set
+// bits of its words
+//
+template <typename Schedule, typename T, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_for_schedule_exec<Schedule>&,
+                                                               TypedBitmaskSegment<T> seg,
+                                                               Func&& loop_body)
+{
+  internal::forall_impl(Schedule{},
+                        TypedRangeSegment<Index_type>(0, seg.getNumWords()),
+                        [&](Index_type w) {
+                          seg.visitWords(w, w + 1, loop_body);
+                        });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+//
+// Box segments are split into compact sub-boxes by repeated halving, at
+// least four per thread, and each thread visits its sub-boxes in the
+// segment traversal order. Static schedules give each thread a contiguous
+// range of sub-boxes, which is itself a compact region of the box.
+//
+template <typename Schedule, typename T, size_t N, typename Order, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_for_schedule_exec<Schedule>&,
+                                                               TypedBoxSegment<T, N, Order> seg,
+                                                               Func&& loop_body)
+{
+  int levels = 0;
+  while ((Index_type(1) << levels) < 4 * omp_get_num_threads() &&
+         (Index_type(1) << levels) < seg.size()) {
+    ++levels;
+  }
+  internal::forall_impl(Schedule{},
+                        TypedRangeSegment<Index_type>(0, Index_type(1) << levels),
+                        [&](Index_type piece) {
+                          seg.getSubBox(piece, levels).visit(loop_body);
+                        });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 template <typename Schedule, typename Iterable, typename Func>
 RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
                                                                const omp_for_nowait_schedule_exec<Schedule>&,
@@ -308,6 +379,127 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+namespace internal
+{
+
+  //
+  // Index value of the first iteration of a range segment, by which the
+  // blocks of an affinity_schedule are recorded; other iterables are
+  // recorded by position
+  //
+  template <typename Iterable>
+  RAJA_INLINE bool affinity_key(const Iterable&, Index_type& key)
+  {
+    key = 0;
+    return false;
+  }
+
+  template <typename T, typename DiffT>
+  RAJA_INLINE bool affinity_key(const TypedRangeSegment<T, DiffT>& seg,
+                                Index_type& key)
+  {
+    key = static_cast<Index_type>(stripIndexType(*seg.begin()));
+    return true;
+  }
+
+  //
+  // Positions [first, last) of a loop of len iterations run by the calling
+  // thread.  When the schedule holds no recording for this kind of loop and
+  // team size, the whole team records its static blocks: after a barrier,
+  // so every thread has taken the same decision from the old recording,
+  // each thread writes its own block and one thread the new recording.  The
+  // first and last threads also take the iterations before and after the
+  // recorded blocks.
+  //
+  RAJA_INLINE void affinity_block(const affinity_schedule& schedule,
+                                  bool by_value,
+                                  Index_type key,
+                                  Index_type len,
+                                  Index_type& first,
+                                  Index_type& last)
+  {
+    const int num_threads = omp_get_num_threads();
+    const int thread = omp_get_thread_num();
+    const Index_type static_first = len * thread / num_threads;
+    const Index_type static_last = len * (thread + 1) / num_threads;
+
+    if (num_threads > schedule.max_threads()) {
+      first = static_first;
+      last = static_last;
+      return;
+    }
+
+    affinity_schedule::Recording& recording = schedule.recording();
+    affinity_schedule::Block& block = schedule.block(thread);
+    if (recording.num_threads != num_threads ||
+        recording.by_value != by_value ||
+        (!by_value && recording.length != len)) {
+      #pragma omp barrier
+      block.first = key + static_first;
+      block.last = key + static_last;
+      #pragma omp single
+      {
+        recording.num_threads = num_threads;
+        recording.by_value = by_value;
+        recording.length = len;
+      }
+    }
+
+    const Index_type lo = (thread == 0) ? 0 : block.first - key;
+    const Index_type hi = (thread + 1 == num_threads) ? len : block.last - key;
+    first = lo < 0 ? 0 : (lo > len ? len : lo);
+    last = hi < first ? first : (hi > len ? len : hi);
+  }
+
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_affinity(const affinity_schedule& schedule,
+                                   Iterable&& iter,
+                                   Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    Index_type key;
+    const bool by_value = affinity_key(iter, key);
+    Index_type first, last;
+    affinity_block(schedule, by_value, key, distance_it, first, last);
+    for (Index_type i = first; i < last; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+} // end namespace internal
+
+///
+/// OpenMP for affinity policy implementation, inside a parallel region
+///
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_for_affinity_exec& p,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  internal::forall_affinity(p.schedule, std::forward<Iterable>(iter), std::forward<Func>(loop_body));
+  #pragma omp barrier
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP parallel for affinity policy implementation
+///
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_parallel_for_affinity_exec& p,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    PersistentTeamLoop in_loop;
+    internal::forall_affinity(p.schedule, iter, body.get_priv());
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -318,6 +510,47 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
 //////////////////////////////////////////////////////////////////////
 //
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments in an omp parallel region, giving
+ *         each thread a contiguous block of segments with about the same
+ *         number of indices.
+ *
+ *         Block boundaries are found by binary search of the segment
+ *         icounts, so segments are neither visited nor sized to split them.
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_parallel_balanced_segit&,
+                                                               const TypedIndexSet<SegmentTypes...>& iset,
+                                                               Func&& loop_body)
+{
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    PersistentTeamLoop in_loop;
+
+    const Index_type len = iset.getLength();
+    const size_t num_seg = iset.getNumSegments();
+    const int num_threads = omp_get_num_threads();
+    const int thread = omp_get_thread_num();
+
+    const size_t begin = iset.getSegmentAtIcount(len * thread / num_threads);
+    const size_t end =
+        (thread + 1 == num_threads)
+            ? num_seg
+            : iset.getSegmentAtIcount(len * (thread + 1) / num_threads);
+
+    for (size_t segid = begin; segid < end; ++segid) {
+      body.get_priv()(segid);
+    }
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 /*!
  ******************************************************************************
  *
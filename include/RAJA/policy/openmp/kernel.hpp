@@ -21,5 +21,6 @@
 
 #include "RAJA/policy/openmp/kernel/Collapse.hpp"
 #include "RAJA/policy/openmp/kernel/OmpSyncThreads.hpp"
+#include "RAJA/policy/openmp/kernel/RecursiveTile.hpp"
 
 #endif  // closing endif for header file include guard
@@ -129,7 +129,96 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
 };
 
 
+/////////
+// Collapsing an arbitrary number of loops
+/////////
+
+/*!
+ * Generic collapse used for any loop nest not covered by the two and three
+ * argument specializations above.
+ *
+ * The product space of the collapsed loops is linearized and divided into
+ * one contiguous, balanced chunk per thread.  Each thread recovers the
+ * indices of its first iteration with one divide per loop and then advances
+ * them like an odometer, so no divides are done per iteration.
+ */
+template <camp::idx_t... Args, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
+                                             ArgList<Args...>,
+                                             EnclosedStmts...>, Types> {
+
+  static constexpr camp::idx_t num_args = sizeof...(Args);
+
+  template <typename Data, camp::idx_t... Dims>
+  static RAJA_INLINE void assign_offsets(Data& data,
+                                         Index_type const* idx,
+                                         camp::idx_seq<Dims...>)
+  {
+    camp::sink((data.template assign_offset<Args>(
+                    static_cast<segment_diff_type<Args, camp::decay<Data>>>(
+                        idx[Dims])),
+                0)...);
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const Index_type lengths[num_args] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
 
+    Index_type total = 1;
+    for (camp::idx_t d = 0; d < num_args; ++d) {
+      total *= lengths[d];
+    }
+    if (total <= 0) {
+      return;
+    }
+
+    // Set the argument types for this loop
+    using NewTypes =
+        typename CollapseSegmentTypes<Types, Data, Args...>::type;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      const Index_type num_threads = omp_get_num_threads();
+      const Index_type thread_id = omp_get_thread_num();
+
+      // the first (total % num_threads) threads get one extra iteration
+      const Index_type chunk = total / num_threads;
+      const Index_type extra = total % num_threads;
+      const Index_type begin =
+          thread_id * chunk + (thread_id < extra ? thread_id : extra);
+      const Index_type end = begin + chunk + (thread_id < extra ? 1 : 0);
+
+      if (begin < end) {
+
+        Index_type idx[num_args];
+        Index_type rem = begin;
+        for (camp::idx_t d = num_args - 1; d >= 0; --d) {
+          idx[d] = rem % lengths[d];
+          rem /= lengths[d];
+        }
+
+        auto& private_data = privatizer.get_priv();
+        for (Index_type i = begin; i < end; ++i) {
+          assign_offsets(private_data,
+                         idx,
+                         camp::make_idx_seq_t<num_args>{});
+          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+              private_data);
+
+          // advance the innermost index, carrying into the outer ones
+          for (camp::idx_t d = num_args - 1; d >= 0 && ++idx[d] == lengths[d];
+               --d) {
+            idx[d] = 0;
+          }
+        }
+      }
+    }
+  }
+};
 
 
 }  // namespace internal
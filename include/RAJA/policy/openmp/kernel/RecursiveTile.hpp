@@ -0,0 +1,174 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for OpenMP recursive tiling of kernel loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_RecursiveTile_HPP
+#define RAJA_policy_openmp_kernel_RecursiveTile_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include <vector>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/RecursiveTile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+///! policy for a recursive tiling with leaves of at most LeafSize iterations
+///! per dimension, where the first TaskDepth levels of splits run in parallel
+template <camp::idx_t LeafSize = 32, camp::idx_t TaskDepth = 6>
+struct omp_cache_oblivious_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For> {
+  static constexpr camp::idx_t leaf_size = LeafSize;
+  static constexpr camp::idx_t task_depth = TaskDepth;
+};
+
+namespace internal
+{
+
+/*!
+ * A RAJA::kernel executor for statement::RecursiveTile that runs the
+ * subtrees below the first TaskDepth splits in parallel, each on a private
+ * copy of the loop data, and visits the leaves of a subtree in order.
+ *
+ * With OpenMP tasks enabled, each of the first TaskDepth splits spawns its
+ * halves as tasks, in the enclosing parallel region if there is one.
+ * Otherwise the subtrees are distributed over the threads of a parallel
+ * loop.
+ */
+template <camp::idx_t... Args,
+          camp::idx_t LeafSize,
+          camp::idx_t TaskDepth,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::RecursiveTile<ArgList<Args...>,
+                             omp_cache_oblivious_exec<LeafSize, TaskDepth>,
+                             EnclosedStmts...>,
+    Types> {
+
+  static_assert(LeafSize > 0,
+                "omp_cache_oblivious_exec leaf size must be positive");
+
+  using Base = RecursiveTileExecutor<ArgList<Args...>, Types, EnclosedStmts...>;
+  using box_type = typename Base::box_type;
+
+  template <typename Data, typename Segments>
+  static void recurse_private(Data const &data,
+                              Segments const &segments,
+                              box_type const &box)
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+    auto &private_data = privatizer.get_priv();
+    Base::recurse(private_data, segments, box, LeafSize);
+  }
+
+#if defined(RAJA_ENABLE_OPENMP_TASK)
+  template <typename Data, typename Segments>
+  static void spawn(Data const *data,
+                    Segments const *segments,
+                    box_type const &box,
+                    camp::idx_t depth)
+  {
+    box_type lo, hi;
+    if (depth < TaskDepth && box.split(LeafSize, lo, hi)) {
+
+#pragma omp task firstprivate(data, segments, lo, depth)
+      spawn(data, segments, lo, depth + 1);
+
+#pragma omp task firstprivate(data, segments, hi, depth)
+      spawn(data, segments, hi, depth + 1);
+
+#pragma omp taskwait
+
+    } else {
+      recurse_private(*data, *segments, box);
+    }
+  }
+#endif
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    const auto segments = Base::get_segments(data);
+    const box_type box = Base::make_box(segments);
+
+    if (box.empty()) {
+      return;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP_TASK)
+
+    if (omp_in_parallel()) {
+      spawn(&data, &segments, box, 0);
+    } else {
+#pragma omp parallel
+#pragma omp master
+      {
+        spawn(&data, &segments, box, 0);
+      }
+    }
+
+#else
+
+    // Split the first TaskDepth levels up front, in recursion order
+    std::vector<box_type> boxes(1, box);
+    for (camp::idx_t depth = 0; depth < TaskDepth; ++depth) {
+      std::vector<box_type> next;
+      next.reserve(2 * boxes.size());
+      for (box_type const &b : boxes) {
+        box_type lo, hi;
+        if (b.split(LeafSize, lo, hi)) {
+          next.push_back(lo);
+          next.push_back(hi);
+        } else {
+          next.push_back(b);
+        }
+      }
+      boxes.swap(next);
+    }
+
+    const int num_boxes = static_cast<int>(boxes.size());
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int b = 0; b < num_boxes; ++b) {
+      recurse_private(data, segments, boxes[b]);
+    }
+
+#endif
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/affinity_schedule.hpp"
 
 // Rely on builtin_atomic when OpenMP can't do the job
 #include "RAJA/policy/atomic_builtin.hpp"
@@ -111,6 +112,17 @@ struct omp_parallel_region
                                             Platform::host> {
 };
 
+///
+///  Struct supporting an OpenMP parallel region whose team is reused by the
+///  RAJA OpenMP foralls, scans, sorts and regions called directly in it.
+///
+struct omp_persistent_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 ///  Struct supporting OpenMP parallel region for Teams
 ///
@@ -121,6 +133,20 @@ struct omp_launch_t
                                             Platform::host> {
 };
 
+///
+///  Struct supporting nested OpenMP parallel regions for Teams. Teams are
+///  executed by groups of threads spread across the OpenMP places, and the
+///  threads of a group are bound close to each other. num_team_threads == 0
+///  uses one thread per hardware thread of a place.
+///
+template <int num_team_threads = 0>
+struct omp_nested_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 
 ///
 ///  Struct supporting OpenMP 'for nowait schedule( )'
@@ -190,6 +216,42 @@ using omp_for_runtime_exec = omp_for_schedule_exec<omp::Runtime>;
 template <int ChunkSize = default_chunk_size>
 using omp_for_nowait_static_exec = omp_for_nowait_schedule_exec<omp::Static<ChunkSize>>;
 
+///
+///  Struct supporting 'omp for' over the blocks of iterations recorded by an
+///  affinity_schedule, so each thread runs the iterations it ran in earlier
+///  loops using the schedule.
+///
+struct omp_for_affinity_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For> {
+  affinity_schedule schedule;
+  omp_for_affinity_exec(affinity_schedule schedule_ = affinity_schedule{})
+      : schedule(schedule_)
+  {
+  }
+};
+
+///
+///  Struct supporting 'omp parallel' region containing an
+///  omp_for_affinity_exec loop.
+///
+struct omp_parallel_for_affinity_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+  affinity_schedule schedule;
+  omp_parallel_for_affinity_exec(
+      affinity_schedule schedule_ = affinity_schedule{})
+      : schedule(schedule_)
+  {
+  }
+};
+
 ///
 ///  Struct supporting OpenMP 'parallel' region containing an inner loop
 ///  execution construct.
@@ -236,6 +298,18 @@ using omp_parallel_for_segit = omp_parallel_for_exec;
 ///
 using omp_parallel_segit = omp_parallel_for_segit;
 
+///
+/// Gives each thread one contiguous block of segments holding about the
+/// same number of indices, found from the segment icounts of the index set.
+///
+struct omp_parallel_balanced_segit
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -335,6 +409,8 @@ using policy::omp::omp_parallel_for_runtime_exec;
 using policy::omp::omp_parallel_for_segit;
 ///
 using policy::omp::omp_parallel_segit;
+///
+using policy::omp::omp_parallel_balanced_segit;
 
 ///
 /// Type alias for omp parallel region containing an inner 'omp for' loop 
@@ -376,14 +452,24 @@ using policy::omp::omp_for_guided_exec;
 ///
 using policy::omp::omp_for_runtime_exec;
 
+///
+/// Type aliases for 'omp for' and 'omp parallel for' loop execution that
+/// replays the thread mapping recorded by a RAJA::affinity_schedule
+///
+using policy::omp::omp_for_affinity_exec;
+///
+using policy::omp::omp_parallel_for_affinity_exec;
+
 ///
 /// Type aliases for omp parallel region
 ///
 using policy::omp::omp_parallel_region;
+using policy::omp::omp_persistent_region;
 
 namespace expt
 {
   using policy::omp::omp_launch_t;
+  using policy::omp::omp_nested_launch_t;
 }
 
 ///
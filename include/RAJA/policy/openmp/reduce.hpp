@@ -36,6 +36,7 @@
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 
 namespace RAJA
 {
@@ -61,6 +62,22 @@ public:
       Base::my_data = Base::identity;
     }
   }
+
+  //! In a persistent team, every thread of the team combines into the
+  //! reducer it was copied from and then reads the combined value
+  T get_combined() const
+  {
+    if (Base::parent && policy::omp::reuse_persistent_team()) {
+#pragma omp critical(ompReduceCritical)
+      Reduce()(Base::parent->local(), Base::my_data);
+      Base::my_data = Base::identity;
+#pragma omp barrier
+      const T combined = Base::parent->local();
+#pragma omp barrier
+      return combined;
+    }
+    return Base::my_data;
+  }
 };
 
 }  // namespace detail
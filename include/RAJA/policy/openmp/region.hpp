@@ -8,6 +8,16 @@
 #ifndef RAJA_region_openmp_HPP
 #define RAJA_region_openmp_HPP
 
+#include "RAJA/config.hpp"
+
+#include <omp.h>
+
+#include <utility>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -15,6 +25,76 @@ namespace policy
 namespace omp
 {
 
+/*!
+ * Persistent team state of the calling thread.
+ *
+ * level   - OpenMP nesting level of the innermost omp_persistent_region the
+ *           thread runs in, or 0 if none
+ * in_loop - set while the thread runs the loop body of a construct that
+ *           reused the team, so constructs called from a loop body open
+ *           regions of their own
+ */
+struct PersistentTeam {
+  int level;
+  bool in_loop;
+
+  static RAJA_INLINE PersistentTeam &get()
+  {
+    static thread_local PersistentTeam team{0, false};
+    return team;
+  }
+};
+
+/*!
+ * Whether a RAJA OpenMP construct called by this thread is run by the team of
+ * an enclosing omp_persistent_region instead of a new parallel region
+ */
+RAJA_INLINE bool reuse_persistent_team()
+{
+  PersistentTeam const &team = PersistentTeam::get();
+  return team.level > 0 && !team.in_loop && team.level == omp_get_level();
+}
+
+/*!
+ * Marks the calling thread as running loop bodies for its lifetime
+ */
+class PersistentTeamLoop
+{
+public:
+  PersistentTeamLoop() : team(PersistentTeam::get()), in_loop(team.in_loop)
+  {
+    team.in_loop = true;
+  }
+
+  ~PersistentTeamLoop() { team.in_loop = in_loop; }
+
+private:
+  PersistentTeam &team;
+  bool in_loop;
+};
+
+/*!
+ * Create an object shared by a persistent team: one thread constructs it
+ * and every thread receives the pointer.  Every thread of the team must call
+ * this, and later team_shared_delete with the pointer.
+ */
+template <typename T, typename... Args>
+RAJA_INLINE T *team_shared_new(Args &&... args)
+{
+  T *ptr = nullptr;
+#pragma omp single copyprivate(ptr)
+  ptr = new T(std::forward<Args>(args)...);
+  return ptr;
+}
+
+template <typename T>
+RAJA_INLINE void team_shared_delete(T *ptr)
+{
+#pragma omp barrier
+#pragma omp single nowait
+  delete ptr;
+}
+
 /*!
  * \brief RAJA::region implementation for OpenMP.
  *
@@ -38,6 +118,17 @@ template <typename Func>
 RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
 {
 
+  if (reuse_persistent_team()) {
+    {
+      //thread private copy of body, run by the enclosing persistent team
+      auto loopbody = body;
+      loopbody();
+    }
+    // stands in for the barrier at the end of a parallel region
+#pragma omp barrier
+    return;
+  }
+
 #pragma omp parallel
     { // curly brackets to ensure body() is encapsulated in omp parallel region
       //thread private copy of body
@@ -46,6 +137,58 @@ RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
     }
 }
 
+/*!
+ * \brief RAJA::region implementation for a persistent OpenMP team.
+ *
+ * Opens a parallel region like omp_parallel_region, and RAJA OpenMP
+ * constructs called directly in the body (forall, pipeline, scan, sort,
+ * launch and omp_parallel_region regions) run as worksharing by the team of
+ * the region rather than forking a team of their own, so a sequence of them
+ * runs under one fork:
+ *
+ * \code
+ *
+ * RAJA::ReduceMin<omp_reduce, double> dt(dt_max);
+ *
+ * RAJA::region<omp_persistent_region>([=](){
+ *
+ *   RAJA::forall<omp_parallel_for_exec>(cells, [=](int i) { ... });
+ *   RAJA::forall<omp_parallel_for_exec>(cells, [=](int i) { dt.min(...); });
+ *
+ *   double step = dt.get();  // combined over the team
+ *
+ *  });
+ *
+ * \endcode
+ *
+ * Every thread of the team must make the same sequence of calls, as with
+ * orphaned worksharing constructs, so they may not be made in a master or
+ * single construct.  Calls made in the loop body of a forall open regions of
+ * their own.
+ * Reducers shared by the team are declared outside the region, and their
+ * get() inside it is a collective call returning the value combined over
+ * the team.
+ *
+ */
+template <typename Func>
+RAJA_INLINE void region_impl(const omp_persistent_region &, Func &&body)
+{
+
+#pragma omp parallel
+    {
+      PersistentTeam &team = PersistentTeam::get();
+      const PersistentTeam enclosing = team;
+      team.level = omp_get_level();
+      team.in_loop = false;
+      {
+        //thread private copy of body
+        auto loopbody = body;
+        loopbody();
+      }
+      team = enclosing;
+    }
+}
+
 }  // namespace omp
 
 }  // namespace policy
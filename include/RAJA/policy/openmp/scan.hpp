@@ -29,6 +29,7 @@
 #include <omp.h>
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
@@ -39,6 +40,101 @@ namespace impl
 namespace scan
 {
 
+namespace detail
+{
+namespace openmp
+{
+
+/*!
+        \brief copy the input of a scan to its output, shared out over the
+   persistent team if there is one
+*/
+template <typename Iter, typename OutIter>
+RAJA_INLINE void copy(Iter begin, Iter end, OutIter out)
+{
+  if (policy::omp::reuse_persistent_team()) {
+    using std::distance;
+    const auto n = distance(begin, end);
+#pragma omp for schedule(static)
+    for (decltype(distance(begin, end)) i = 0; i < n; ++i) {
+      out[i] = begin[i];
+    }
+  } else {
+    ::std::copy(begin, end, out);
+  }
+}
+
+/*!
+        \brief inclusive inplace scan run by every thread of the current team,
+   with one entry of sums per thread
+*/
+template <typename Iter, typename BinFn, typename DistanceT, typename Value>
+RAJA_INLINE void inclusive_inplace_team(resources::Host host_res,
+                                        Iter begin,
+                                        DistanceT n,
+                                        BinFn f,
+                                        Value* sums)
+{
+  using RAJA::detail::firstIndex;
+  const int p = omp_get_num_threads();
+  const int pid = omp_get_thread_num();
+  const DistanceT idx_begin = firstIndex(n, p, pid);
+  const DistanceT idx_end = firstIndex(n, p, pid + 1);
+  if (idx_begin != idx_end) {
+    inclusive_inplace(host_res, ::RAJA::loop_exec{},
+                      begin + idx_begin, begin + idx_end, f);
+    sums[pid] = begin[idx_end - 1];
+  }
+#pragma omp barrier
+#pragma omp single
+  exclusive_inplace(host_res, ::RAJA::loop_exec{},
+                    sums, sums + p, f, BinFn::identity());
+  for (auto i = idx_begin; i < idx_end; ++i) {
+    begin[i] = f(begin[i], sums[pid]);
+  }
+}
+
+/*!
+        \brief exclusive inplace scan run by every thread of the current team,
+   with one entry of sums per thread
+*/
+template <typename Iter,
+          typename BinFn,
+          typename ValueT,
+          typename DistanceT,
+          typename Value>
+RAJA_INLINE void exclusive_inplace_team(resources::Host host_res,
+                                        Iter begin,
+                                        DistanceT n,
+                                        BinFn f,
+                                        ValueT v,
+                                        Value* sums)
+{
+  using RAJA::detail::firstIndex;
+  const int p = omp_get_num_threads();
+  const int pid = omp_get_thread_num();
+  const DistanceT idx_begin = firstIndex(n, p, pid);
+  const DistanceT idx_end = firstIndex(n, p, pid + 1);
+  const Value init = ((idx_begin == 0) ? v : *(begin + idx_begin - 1));
+#pragma omp barrier
+  if (idx_begin != idx_end) {
+    exclusive_inplace(host_res, loop_exec{},
+                      begin + idx_begin, begin + idx_end, f, init);
+    sums[pid] = begin[idx_end - 1];
+  }
+#pragma omp barrier
+#pragma omp single
+  exclusive_inplace(host_res, loop_exec{},
+                    sums, sums + p, f, BinFn::identity());
+  for (auto i = idx_begin; i < idx_end; ++i) {
+    begin[i] = f(begin[i], sums[pid]);
+  }
+}
+
+}  // namespace openmp
+
+}  // namespace detail
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
@@ -55,30 +151,25 @@ inclusive_inplace(
     BinFn f)
 {
   using std::distance;
-  using RAJA::detail::firstIndex;
   using Value = typename ::std::iterator_traits<Iter>::value_type;
   const auto n = distance(begin, end);
   using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  if (policy::omp::reuse_persistent_team()) {
+    auto* sums = policy::omp::team_shared_new<::std::vector<Value>>(
+        omp_get_num_threads(), BinFn::identity());
+    detail::openmp::inclusive_inplace_team(
+        host_res, begin, n, f, sums->data());
+    policy::omp::team_shared_delete(sums);
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+
   const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
   ::std::vector<Value> sums(p0, Value());
 #pragma omp parallel num_threads(p0)
   {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    if (idx_begin != idx_end) {
-      inclusive_inplace(host_res, ::RAJA::loop_exec{},
-                        begin + idx_begin, begin + idx_end, f);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, ::RAJA::loop_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
+    detail::openmp::inclusive_inplace_team(
+        host_res, begin, n, f, sums.data());
   }
 
   return resources::EventProxy<resources::Host>(host_res);
@@ -101,32 +192,25 @@ exclusive_inplace(
     ValueT v)
 {
   using std::distance;
-  using RAJA::detail::firstIndex;
   using Value = typename ::std::iterator_traits<Iter>::value_type;
   const auto n = distance(begin, end);
   using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  if (policy::omp::reuse_persistent_team()) {
+    auto* sums = policy::omp::team_shared_new<::std::vector<Value>>(
+        omp_get_num_threads(), BinFn::identity());
+    detail::openmp::exclusive_inplace_team(
+        host_res, begin, n, f, v, sums->data());
+    policy::omp::team_shared_delete(sums);
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+
   const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
   ::std::vector<Value> sums(p0, v);
 #pragma omp parallel num_threads(p0)
   {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + idx_begin - 1));
-#pragma omp barrier
-    if (idx_begin != idx_end) {
-      exclusive_inplace(host_res, loop_exec{},
-                        begin + idx_begin, begin + idx_end, f, init);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, loop_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
+    detail::openmp::exclusive_inplace_team(
+        host_res, begin, n, f, v, sums.data());
   }
 
   return resources::EventProxy<resources::Host>(host_res);
@@ -149,7 +233,7 @@ inclusive(
     BinFn f)
 {
   using std::distance;
-  ::std::copy(begin, end, out);
+  detail::openmp::copy(begin, end, out);
   return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
 }
 
@@ -175,7 +259,7 @@ exclusive(
     ValueT v)
 {
   using std::distance;
-  ::std::copy(begin, end, out);
+  detail::openmp::copy(begin, end, out);
   return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
 }
 
@@ -31,6 +31,7 @@
 #include "RAJA/util/concepts.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
@@ -86,7 +87,7 @@ inline void sort_task(Sorter sorter,
   }
 }
 
-#else
+#endif
 
 /*!
         \brief sort given range using sorter and comparison function
@@ -132,8 +133,6 @@ inline void sort_parallel_region(Sorter sorter,
   }
 }
 
-#endif
-
 
 /*!
         \brief sort given range using sorter and comparison function
@@ -151,7 +150,18 @@ void sort(Sorter sorter,
 
   const diff_type n = end - begin;
 
-  if (n <= min_iterates_per_task) {
+  if (::RAJA::policy::omp::reuse_persistent_team()) {
+
+    // every thread of the persistent team is here, so sort with the team
+    if (n <= min_iterates_per_task) {
+#pragma omp single
+      sorter(begin, end, comp);
+    } else {
+      sort_parallel_region(sorter, begin, n, comp);
+#pragma omp barrier
+    }
+
+  } else if (n <= min_iterates_per_task) {
 
     sorter(begin, end, comp);
 
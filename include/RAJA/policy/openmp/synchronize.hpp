@@ -18,6 +18,18 @@
 #ifndef RAJA_synchronize_openmp_HPP
 #define RAJA_synchronize_openmp_HPP
 
+#include "RAJA/config.hpp"
+
+#include <omp.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
 namespace RAJA
 {
 
@@ -36,9 +48,127 @@ void synchronize_impl(const omp_synchronize&)
 #pragma omp barrier
 }
 
+/*!
+ * \brief Dependency token for nowait loops in an OpenMP parallel region.
+ *
+ * Each thread of the team calls signal() when it has finished its share of
+ * the loops the token stands for, and wait() before a loop that needs them
+ * to be complete.  Only the threads that wait are held up, and only until
+ * every thread has signaled, so loops that do not depend on the token keep
+ * running in between:
+ *
+ * \code
+ *
+ * RAJA::omp_loop_token a_done;
+ *
+ * RAJA::region<RAJA::omp_parallel_region>([=]() {
+ *
+ *   RAJA::forall<RAJA::omp_for_nowait_static_exec< >>(seg, loop_a);
+ *   a_done.signal();
+ *
+ *   RAJA::forall<RAJA::omp_for_nowait_static_exec< >>(seg, loop_b);
+ *
+ *   a_done.wait();
+ *   RAJA::forall<RAJA::omp_for_nowait_static_exec< >>(seg, loop_c);
+ *
+ * });
+ *
+ * \endcode
+ *
+ * With static schedules over the same segment, a loop that only reads
+ * points owned by neighboring threads, like a stencil, may instead call
+ * wait_neighbors(), which waits on the threads within a given distance of
+ * the caller.
+ *
+ * Every thread keeps a count of its signals in its own cache line, and a
+ * thread waits until the counts of the threads it depends on reach its own.
+ * The token is created outside the region and captured by copy; copies
+ * share the counts, and every thread of the team must signal the token the
+ * same number of times.  A token may be used by successive regions with the
+ * same number of threads.
+ */
+class omp_loop_token
+{
+  // padded so the counts of different threads never share a cache line,
+  // without over-aligning them for operator new[]
+  struct Count {
+    std::atomic<long> value;
+    char padding[128 - sizeof(std::atomic<long>)];
+  };
+
+public:
+  explicit omp_loop_token(int max_threads = omp_get_max_threads())
+      : num_counts(max_threads > 0 ? max_threads : 1),
+        counts(new Count[num_counts], std::default_delete<Count[]>())
+  {
+    for (int t = 0; t < num_counts; ++t) {
+      counts.get()[t].value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  //! Mark the calling thread's share of the preceding loops as complete
+  void signal() const
+  {
+    Count &mine = own_count();
+    mine.value.store(mine.value.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_release);
+  }
+
+  //! Wait until every thread of the team has signaled as often as the caller
+  void wait() const
+  {
+    const long target = own_count().value.load(std::memory_order_relaxed);
+    const int num_threads = omp_get_num_threads();
+    for (int t = 0; t < num_threads; ++t) {
+      wait_for(t, target);
+    }
+  }
+
+  //! Wait until the threads within distance of the caller in the team have
+  //! signaled as often as the caller
+  void wait_neighbors(int distance = 1) const
+  {
+    const long target = own_count().value.load(std::memory_order_relaxed);
+    const int num_threads = omp_get_num_threads();
+    const int thread = omp_get_thread_num();
+    const int first = thread - distance > 0 ? thread - distance : 0;
+    const int last = thread + distance < num_threads - 1 ? thread + distance
+                                                         : num_threads - 1;
+    for (int t = first; t <= last; ++t) {
+      wait_for(t, target);
+    }
+  }
+
+private:
+  Count &own_count() const
+  {
+    const int thread = omp_get_thread_num();
+    if (omp_get_num_threads() > num_counts) {
+      RAJA_ABORT_OR_THROW("omp_loop_token used by more threads than it was created for");
+    }
+    return counts.get()[thread];
+  }
+
+  void wait_for(int thread, long target) const
+  {
+    std::atomic<long> const &value = counts.get()[thread].value;
+    for (int spin = 0; value.load(std::memory_order_acquire) < target; ++spin) {
+      if (spin >= 64) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  int num_counts;
+  std::shared_ptr<Count> counts;
+};
+
 
 }  // end of namespace omp
 }  // namespace policy
+
+using policy::omp::omp_loop_token;
+
 }  // end of namespace RAJA
 
 #endif  // RAJA_synchronize_openmp_HPP
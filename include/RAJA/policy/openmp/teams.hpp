@@ -18,8 +18,15 @@
 #ifndef RAJA_pattern_teams_openmp_HPP
 #define RAJA_pattern_teams_openmp_HPP
 
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 
 
 namespace RAJA
@@ -28,17 +35,111 @@ namespace RAJA
 namespace expt
 {
 
+namespace detail
+{
+
+//
+// Partial results of team reductions and scans, one slot per thread of an
+// OpenMP team, padded so that threads publishing their partials do not
+// share cache lines.  Each slot is double buffered: consecutive calls
+// alternate between the halves, so a call needs only the barrier that
+// publishes the partials, since a half is rewritten two calls later, after
+// every thread has passed the barrier of the call in between.
+//
+struct HostTeamScratch {
+
+  static constexpr size_t slot_bytes = 128;
+
+  struct Slot {
+    unsigned char value[2][slot_bytes];
+    int phase;
+    char padding[slot_bytes - sizeof(int)];
+  };
+
+  std::unique_ptr<void, RAJA::FreeAligned> buffer;
+  int num_threads;
+  int level;
+
+  HostTeamScratch(int threads, int team_level)
+      : buffer(RAJA::allocate_aligned(slot_bytes, threads * sizeof(Slot))),
+        num_threads(threads),
+        level(team_level)
+  {
+    for (int t = 0; t < num_threads; ++t) {
+      new (&slot(t)) Slot();
+    }
+  }
+
+  Slot &slot(int t) { return static_cast<Slot *>(buffer.get())[t]; }
+
+  //
+  // Whether partials of type T of the calling thread's team fit the slots;
+  // loops in regions nested inside the launch body use other storage
+  //
+  template <typename T>
+  bool holds() const
+  {
+    return std::is_trivially_copyable<T>::value && sizeof(T) <= slot_bytes &&
+           alignof(T) <= slot_bytes && level == omp_get_level() &&
+           omp_get_num_threads() <= num_threads;
+  }
+
+  //
+  // Store the partial of thread pid, returns the half holding the partials
+  // of this call
+  //
+  template <typename T>
+  int publish(int pid, T const &value)
+  {
+    Slot &s = slot(pid);
+    const int phase = s.phase;
+    s.phase = 1 - phase;
+    new (s.value[phase]) T(value);
+    return phase;
+  }
+
+  template <typename T>
+  T const &partial(int t, int phase)
+  {
+    return *reinterpret_cast<T const *>(slot(t).value[phase]);
+  }
+};
+
+}  // namespace detail
+
 template <>
 struct LaunchExecute<RAJA::expt::omp_launch_t> {
 
-
+  //
+  // Each OpenMP thread gets its own copy of the context and scratch memory;
+  // teams are executed by single threads so teamSync() needs no barrier.
+  // The threads share the slots for the partials of team reductions and
+  // scans over omp_for_exec loops.
+  // The launch body runs as a loop body of a persistent team it reuses, so
+  // foralls inside its loops open regions of their own.
+  //
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
     RAJA::region<RAJA::omp_parallel_region>([&]() {
       using RAJA::internal::thread_privatize;
       auto loop_body = thread_privatize(body);
-      loop_body.get_priv()(ctx);
+
+      detail::HostTeamSharedMemory shmem(ctx.shared_mem_size);
+      LaunchContext thread_ctx(ctx);
+      thread_ctx.shared_mem_ptr = shmem.get();
+
+      auto *scratch =
+          RAJA::policy::omp::team_shared_new<detail::HostTeamScratch>(
+              omp_get_num_threads(), omp_get_level());
+      thread_ctx.host_team_scratch = scratch;
+
+      {
+        RAJA::policy::omp::PersistentTeamLoop in_loop;
+        loop_body.get_priv()(thread_ctx);
+      }
+
+      RAJA::policy::omp::team_shared_delete(scratch);
     });
   }
 
@@ -46,11 +147,7 @@ struct LaunchExecute<RAJA::expt::omp_launch_t> {
   static resources::EventProxy<resources::Resource>
   exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
   {
-    RAJA::region<RAJA::omp_parallel_region>([&]() {
-      using RAJA::internal::thread_privatize;
-      auto loop_body = thread_privatize(body);
-      loop_body.get_priv()(ctx);
-    });
+    exec(ctx, body);
 
     return resources::EventProxy<resources::Resource>(res);
   }
@@ -200,6 +297,214 @@ struct LoopExecute<omp_for_exec, SEGMENT> {
   }
 };
 
+template <typename SEGMENT>
+struct LoopICountExecute<omp_for_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    int len = segment.end() - segment.begin();
+#pragma omp for
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i), i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp for
+    for (int j = 0; j < len1; j++) {
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp for
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k),
+               i,
+               j,
+               k);
+        }
+      }
+    }
+  }
+};
+
+//
+// Team reduction and scans over loops that are work-shared across all
+// threads of the launch region; every thread must reach the call.
+//
+template <typename SEGMENT>
+struct LoopReduceExecute<omp_for_exec, SEGMENT> {
+
+  template <typename T, typename REDUCE_OP, typename BODY>
+  static RAJA_INLINE T exec(LaunchContext const &ctx,
+                            SEGMENT const &segment,
+                            T init,
+                            REDUCE_OP const &op,
+                            BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+
+    T local = REDUCE_OP::identity();
+#pragma omp for schedule(static) nowait
+    for (int i = 0; i < len; i++) {
+      local = op(local, body(*(segment.begin() + i)));
+    }
+
+    T result = init;
+    detail::HostTeamScratch *scratch = ctx.host_team_scratch;
+    if (scratch && scratch->holds<T>()) {
+      const int phase = scratch->publish(pid, local);
+#pragma omp barrier
+      for (int t = 0; t < p; ++t) {
+        result = op(result, scratch->partial<T>(t, phase));
+      }
+      return result;
+    }
+
+    auto *partials =
+        RAJA::policy::omp::team_shared_new<std::unique_ptr<T[]>>(new T[p]);
+    (*partials)[pid] = local;
+
+#pragma omp barrier
+    for (int t = 0; t < p; ++t) {
+      result = op(result, (*partials)[t]);
+    }
+
+    RAJA::policy::omp::team_shared_delete(partials);
+    return result;
+  }
+};
+
+template <typename SEGMENT>
+struct LoopScanExecute<omp_for_exec, SEGMENT> {
+
+  template <typename T, typename SCAN_OP>
+  static RAJA_INLINE void inclusive(LaunchContext const &ctx,
+                                    SEGMENT const &segment,
+                                    T *data,
+                                    SCAN_OP const &op)
+  {
+    scan(ctx, segment, data, op, SCAN_OP::identity(), false);
+  }
+
+  template <typename T, typename SCAN_OP>
+  static RAJA_INLINE void exclusive(LaunchContext const &ctx,
+                                    SEGMENT const &segment,
+                                    T *data,
+                                    SCAN_OP const &op,
+                                    T init)
+  {
+    scan(ctx, segment, data, op, init, true);
+  }
+
+private:
+  //
+  // Each thread reduces (inclusive: scans) a contiguous block, the block
+  // totals are shared, and each thread then finishes its block using the
+  // total of the preceding blocks as offset
+  //
+  template <typename T, typename SCAN_OP>
+  static RAJA_INLINE void scan(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               T *data,
+                               SCAN_OP const &op,
+                               T init,
+                               bool is_exclusive)
+  {
+    using RAJA::detail::firstIndex;
+
+    const int len = segment.end() - segment.begin();
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const int idx_begin = firstIndex(len, p, pid);
+    const int idx_end = firstIndex(len, p, pid + 1);
+
+    T local = SCAN_OP::identity();
+    for (int i = idx_begin; i < idx_end; ++i) {
+      auto idx = *(segment.begin() + i);
+      local = op(local, data[idx]);
+      if (!is_exclusive) {
+        data[idx] = local;
+      }
+    }
+    T offset = is_exclusive ? init : SCAN_OP::identity();
+    detail::HostTeamScratch *scratch = ctx.host_team_scratch;
+    if (scratch && scratch->holds<T>()) {
+      const int phase = scratch->publish(pid, local);
+#pragma omp barrier
+      for (int t = 0; t < pid; ++t) {
+        offset = op(offset, scratch->partial<T>(t, phase));
+      }
+    } else {
+      auto *sums =
+          RAJA::policy::omp::team_shared_new<std::unique_ptr<T[]>>(new T[p]);
+      (*sums)[pid] = local;
+#pragma omp barrier
+      for (int t = 0; t < pid; ++t) {
+        offset = op(offset, (*sums)[t]);
+      }
+      RAJA::policy::omp::team_shared_delete(sums);
+    }
+
+    if (is_exclusive) {
+      T sum = offset;
+      for (int i = idx_begin; i < idx_end; ++i) {
+        auto idx = *(segment.begin() + i);
+        T val = data[idx];
+        data[idx] = sum;
+        sum = op(sum, val);
+      }
+    } else {
+      for (int i = idx_begin; i < idx_end; ++i) {
+        auto idx = *(segment.begin() + i);
+        data[idx] = op(offset, data[idx]);
+      }
+    }
+
+    // the scanned data is complete when the threads leave the call
+#pragma omp barrier
+  }
+};
+
 //
 // Return local index
 //
@@ -505,7 +810,255 @@ struct TileICountExecute<omp_for_exec, SEGMENT> {
 #pragma omp for
     for (int i = 0; i < numTiles; i++) {
       const int i_tile_size = i * tile_size;
-      body.get_priv()(segment.slice(i_tile_size, tile_size), i);
+      body(segment.slice(i_tile_size, tile_size), i);
+    }
+  }
+};
+
+namespace detail
+{
+
+//
+// Raises the maximum number of active OpenMP levels for its lifetime, so
+// that both regions of a nested launch are active even when the launch is
+// made inside a parallel region, and restores it afterwards
+//
+class OmpActiveLevelsGuard
+{
+public:
+  explicit OmpActiveLevelsGuard(int levels)
+      : saved_levels(omp_get_max_active_levels())
+  {
+    if (saved_levels < levels) {
+      omp_set_max_active_levels(levels);
+    }
+  }
+
+  ~OmpActiveLevelsGuard()
+  {
+    if (omp_get_max_active_levels() != saved_levels) {
+      omp_set_max_active_levels(saved_levels);
+    }
+  }
+
+  OmpActiveLevelsGuard(OmpActiveLevelsGuard const &) = delete;
+  OmpActiveLevelsGuard &operator=(OmpActiveLevelsGuard const &) = delete;
+
+private:
+  int saved_levels;
+};
+
+}  // namespace detail
+
+//
+// Nested launch: the outer parallel region has one thread per group, spread
+// across the OpenMP places, and each group opens an inner region whose
+// threads are bound close together.  A team is executed by a whole group,
+// so its scratch memory is shared by the group and teamSync() is a barrier.
+// Thread loops must share their iterations across the group (omp_for_exec);
+// other policies run the whole loop on every thread of the group.
+//
+template <int num_team_threads>
+struct LaunchExecute<RAJA::expt::omp_nested_launch_t<num_team_threads>> {
+
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    const int num_places = omp_get_num_places();
+    const int team_threads =
+        num_team_threads > 0
+            ? num_team_threads
+            : (num_places > 0 ? omp_get_place_num_procs(0) : 1);
+    const int num_groups =
+        num_places > 0 ? num_places
+                       : std::max(1, omp_get_max_threads() / team_threads);
+
+    detail::OmpActiveLevelsGuard active_levels(omp_get_active_level() + 2);
+
+#pragma omp parallel num_threads(num_groups) proc_bind(spread)
+    {
+      detail::HostTeamSharedMemory shmem(ctx.shared_mem_size);
+      LaunchContext team_ctx(ctx);
+      team_ctx.shared_mem_ptr = shmem.get();
+      team_ctx.host_team_barrier = true;
+      team_ctx.host_team_level = omp_get_level();
+
+#pragma omp parallel num_threads(team_threads) proc_bind(close) \
+    firstprivate(team_ctx)
+      {
+        using RAJA::internal::thread_privatize;
+        auto loop_body = thread_privatize(body);
+
+        auto *scratch =
+            RAJA::policy::omp::team_shared_new<detail::HostTeamScratch>(
+                omp_get_num_threads(), omp_get_level());
+        team_ctx.host_team_scratch = scratch;
+
+        loop_body.get_priv()(team_ctx);
+
+        RAJA::policy::omp::team_shared_delete(scratch);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
+  {
+    exec(ctx, body);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+};
+
+// policy distributing team loops across the thread groups of a nested launch
+struct omp_team_distribute_exec;
+
+namespace detail
+{
+
+//
+// Contiguous block [begin, end) of [0, len) owned by the calling thread
+// group; the same block is returned to every thread of the group.  Outside
+// a nested launch the calling thread is the only group.
+//
+RAJA_INLINE void omp_team_block(LaunchContext const &ctx,
+                                int len,
+                                int &begin,
+                                int &end)
+{
+  using RAJA::detail::firstIndex;
+
+  const int level = ctx.host_team_level;
+  if (level == 0 && omp_in_parallel()) {
+    RAJA_ABORT_OR_THROW("omp_team_distribute_exec loops in a parallel region "
+                        "must be run by an omp_nested_launch_t launch");
+  }
+
+  const int group = level > 0 ? omp_get_ancestor_thread_num(level) : 0;
+  const int num_groups = level > 0 ? omp_get_team_size(level) : 1;
+
+  begin = firstIndex(len, num_groups, group);
+  end = firstIndex(len, num_groups, group + 1);
+}
+
+}  // namespace detail
+
+template <typename SEGMENT>
+struct LoopExecute<omp_team_distribute_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    int begin, end;
+    detail::omp_team_block(ctx, segment.end() - segment.begin(), begin, end);
+    for (int i = begin; i < end; i++) {
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    int begin, end;
+    detail::omp_team_block(ctx, len0 * len1, begin, end);
+    for (int t = begin; t < end; t++) {
+      const int j = t / len0;
+      const int i = t - j * len0;
+      body(*(segment0.begin() + i), *(segment1.begin() + j));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    int begin, end;
+    detail::omp_team_block(ctx, len0 * len1 * len2, begin, end);
+    for (int t = begin; t < end; t++) {
+      const int k = t / (len0 * len1);
+      const int j = (t - k * len0 * len1) / len0;
+      const int i = t - (k * len1 + j) * len0;
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           *(segment2.begin() + k));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_team_distribute_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    int begin, end;
+    detail::omp_team_block(ctx, segment.end() - segment.begin(), begin, end);
+    for (int i = begin; i < end; i++) {
+      body(*(segment.begin() + i), i);
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_team_distribute_exec, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+
+    int begin, end;
+    detail::omp_team_block(ctx, len > 0 ? numTiles : 0, begin, end);
+    for (int i = begin; i < end; i++) {
+      body(segment.slice(i * tile_size, tile_size));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<omp_team_distribute_exec, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+
+    int begin, end;
+    detail::omp_team_block(ctx, len > 0 ? numTiles : 0, begin, end);
+    for (int i = begin; i < end; i++) {
+      body(segment.slice(i * tile_size, tile_size), i);
     }
   }
 };
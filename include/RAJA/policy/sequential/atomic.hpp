@@ -22,6 +22,8 @@
 
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/policy/atomic_order.hpp"
+
 namespace RAJA
 {
 
@@ -158,6 +160,17 @@ RAJA_INLINE T atomicCAS(seq_atomic, T volatile *acc, T compare, T value)
   return ret;
 }
 
+namespace detail
+{
+
+//! seq_atomic operations never run concurrently, so need no ordering
+template <typename Order>
+struct atomic_order_fence<seq_atomic, Order>
+    : memory_order_fence<memory_order_relaxed> {
+};
+
+}  // namespace detail
+
 
 }  // namespace RAJA
 
@@ -64,6 +64,73 @@ struct LoopICountExecute<seq_exec, SEGMENT> {
   }
 };
 
+template <typename SEGMENT>
+struct LoopReduceExecute<seq_exec, SEGMENT> {
+
+  template <typename T, typename REDUCE_OP, typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE T exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      T init,
+      REDUCE_OP const &op,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    T result = init;
+    RAJA_NO_SIMD
+    for (int i = 0; i < len; i++) {
+      result = op(result, body(*(segment.begin() + i)));
+    }
+    return result;
+  }
+};
+
+template <typename SEGMENT>
+struct LoopScanExecute<seq_exec, SEGMENT> {
+
+  template <typename T, typename SCAN_OP>
+  static RAJA_INLINE RAJA_HOST_DEVICE void inclusive(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      T *data,
+      SCAN_OP const &op)
+  {
+
+    const int len = segment.end() - segment.begin();
+    if (len <= 0) {
+      return;
+    }
+    T sum = data[*segment.begin()];
+    RAJA_NO_SIMD
+    for (int i = 1; i < len; i++) {
+      auto idx = *(segment.begin() + i);
+      sum = op(sum, data[idx]);
+      data[idx] = sum;
+    }
+  }
+
+  template <typename T, typename SCAN_OP>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exclusive(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      T *data,
+      SCAN_OP const &op,
+      T init)
+  {
+
+    const int len = segment.end() - segment.begin();
+    T sum = init;
+    RAJA_NO_SIMD
+    for (int i = 0; i < len; i++) {
+      auto idx = *(segment.begin() + i);
+      T val = data[idx];
+      data[idx] = sum;
+      sum = op(sum, val);
+    }
+  }
+};
+
 }  // namespace expt
 
 }  // namespace RAJA
@@ -33,6 +33,10 @@
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/index/BitmaskSegment.hpp"
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/policy/simd/policy.hpp"
@@ -62,6 +66,57 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   return RAJA::resources::EventProxy<resources::Host>(host_res);
 }
 
+//
+// Compressed list segments are decoded one block at a time, and both the
+// decoding and the loop over the decoded block are vectorized
+//
+template <typename T, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::Host host_res,
+                                                               const simd_exec &,
+                                                               TypedCompressedListSegment<T> seg,
+                                                               Func &&loop_body)
+{
+  T block[TypedCompressedListSegment<T>::block_size];
+  const Index_type num_blocks = seg.getNumBlocks();
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type len = seg.decodeBlock(b, block);
+
+    RAJA_SIMD
+    for (Index_type i = 0; i < len; ++i) {
+      loop_body(block[i]);
+    }
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
+//
+// The set bits of a word do not form a vectorizable loop, so bitmask
+// segments visit them as the sequential policy does
+//
+template <typename T, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::Host host_res,
+                                                               const simd_exec &,
+                                                               TypedBitmaskSegment<T> seg,
+                                                               Func &&loop_body)
+{
+  seg.visitWords(0, seg.getNumWords(), loop_body);
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
+//
+// Box segments are visited in their traversal order
+//
+template <typename T, size_t N, typename Order, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::Host host_res,
+                                                               const simd_exec &,
+                                                               TypedBoxSegment<T, N, Order> seg,
+                                                               Func &&loop_body)
+{
+  seg.visit(loop_body);
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace simd
 
 }  // namespace policy
@@ -20,6 +20,7 @@
 
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/simd/policy.hpp"
+#include "RAJA/policy/sequential/teams.hpp"
 
 
 namespace RAJA
@@ -64,6 +65,18 @@ struct LoopICountExecute<simd_exec, SEGMENT> {
   }
 };
 
+//
+// Team reductions and scans carry a loop dependence, so they run sequentially
+//
+template <typename SEGMENT>
+struct LoopReduceExecute<simd_exec, SEGMENT>
+    : LoopReduceExecute<seq_exec, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopScanExecute<simd_exec, SEGMENT> : LoopScanExecute<seq_exec, SEGMENT> {
+};
+
 }  // namespace expt
 
 }  // namespace RAJA
@@ -27,6 +27,7 @@
 
 #include <tbb/tbb.h>
 
+#include "RAJA/index/BitmaskSegment.hpp"
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
@@ -137,6 +138,100 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/**
+ * @brief TBB affinity for implementation
+ *
+ * @param p tbb_for_affinity tag holding an affinity_schedule
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall implements a TBB parallel_for loop over the specified iterable
+ * using the tbb::affinity_partitioner of the schedule in the policy argument.
+ * The partitioner records which worker thread ran each subrange, and a later
+ * loop of the same length run with the schedule sends each subrange back to
+ * that thread, so data it touched is still in its cache.
+ */
+
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const tbb_for_affinity& p,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  ::tbb::parallel_for(
+      brange(0, dist, p.grain_size),
+      [=](const brange& r) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        for (auto i = r.begin(); i != r.end(); ++i)
+          body(b[i]);
+      },
+      p.schedule.tbb_partitioner());
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/**
+ * @brief TBB dynamic for implementation over a bitmask segment
+ *
+ * The bitmap is split on word boundaries, with the policy grain size
+ * counted in words, and each task visits the set bits of its words.
+ */
+
+template <typename T, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const tbb_for_dynamic& p,
+                                                               TypedBitmaskSegment<T> seg,
+                                                               Func&& loop_body)
+{
+  using brange = ::tbb::blocked_range<size_t>;
+  size_t num_words = seg.getNumWords();
+  ::tbb::parallel_for(brange(0, num_words, p.grain_size), [=](const brange& r) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto body = privatizer.get_priv();
+    seg.visitWords(r.begin(), r.end(), body);
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/**
+ * @brief TBB static for implementation over a bitmask segment
+ *
+ * The bitmap is split on word boundaries, with ChunkSize counted in words.
+ */
+
+template <typename T, typename Func, size_t ChunkSize>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const tbb_for_static<ChunkSize>&,
+                                                               TypedBitmaskSegment<T> seg,
+                                                               Func&& loop_body)
+{
+  using brange = ::tbb::blocked_range<size_t>;
+  size_t num_words = seg.getNumWords();
+  ::tbb::parallel_for(
+      brange(0, num_words, ChunkSize),
+      [=](const brange& r) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        seg.visitWords(r.begin(), r.end(), body);
+      },
+      tbb_static_partitioner{});
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace tbb
 }  // namespace policy
 
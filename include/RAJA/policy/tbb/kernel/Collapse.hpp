@@ -0,0 +1,300 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for TBB collapse constructs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_collapse_HPP
+#define RAJA_policy_tbb_kernel_collapse_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include <type_traits>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Collapse.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+namespace detail
+{
+
+// Grain size of collapsed loop d, 1 if the policy gives none
+template <std::size_t... GrainSizes>
+RAJA_INLINE std::size_t tbb_collapse_grain(std::size_t d)
+{
+  const std::size_t grains[] = {GrainSizes..., 1};
+  return d < sizeof...(GrainSizes) ? grains[d] : 1;
+}
+
+template <typename Range, typename Body>
+RAJA_INLINE void tbb_collapse_for(std::false_type,
+                                  const Range& range,
+                                  const Body& body)
+{
+  ::tbb::parallel_for(range, body, ::tbb::auto_partitioner{});
+}
+
+// The partitioner records which thread ran each subrange and replays that
+// mapping when the same loop nest runs again.  There is one partitioner per
+// loop nest (Body is unique to it) and calling thread, since a partitioner
+// must not be shared by concurrent parallel_for calls.
+template <typename Range, typename Body>
+RAJA_INLINE void tbb_collapse_for(std::true_type,
+                                  const Range& range,
+                                  const Body& body)
+{
+  static thread_local ::tbb::affinity_partitioner partitioner;
+  ::tbb::parallel_for(range, body, partitioner);
+}
+
+}  // namespace detail
+
+/////////
+// Collapsing two loops
+/////////
+
+/*!
+ * The product space is a tbb::blocked_range2d, which TBB splits recursively
+ * along its longer dimension until each piece is no larger than the grain
+ * sizes, so pieces stay roughly square and cache-friendly at every level.
+ * Grain sizes that match the tile sizes of the loop body keep tiles whole.
+ */
+template <bool Affinity,
+          std::size_t... GrainSizes,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<policy::tbb::tbb_collapse<Affinity, GrainSizes...>,
+                        ArgList<Arg0, Arg1>,
+                        EnclosedStmts...>,
+    Types> {
+
+  static_assert(sizeof...(GrainSizes) == 0 || sizeof...(GrainSizes) == 2,
+                "tbb collapse policy needs one grain size per loop");
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const std::size_t l0 = segment_length<Arg0>(data);
+    const std::size_t l1 = segment_length<Arg1>(data);
+
+    // Set the argument types for this loop
+    using NewTypes = typename CollapseSegmentTypes<Types, Data, Arg0, Arg1>::type;
+
+    using brange = ::tbb::blocked_range2d<std::size_t>;
+    const brange range(0, l0, detail::tbb_collapse_grain<GrainSizes...>(0),
+                       0, l1, detail::tbb_collapse_grain<GrainSizes...>(1));
+
+    detail::tbb_collapse_for(
+        std::integral_constant<bool, Affinity>{}, range, [&](const brange& r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(data);
+          auto& private_data = privatizer.get_priv();
+          for (auto i0 = r.rows().begin(); i0 != r.rows().end(); ++i0) {
+            for (auto i1 = r.cols().begin(); i1 != r.cols().end(); ++i1) {
+              private_data.template assign_offset<Arg0>(
+                  static_cast<segment_diff_type<Arg0, camp::decay<Data>>>(i0));
+              private_data.template assign_offset<Arg1>(
+                  static_cast<segment_diff_type<Arg1, camp::decay<Data>>>(i1));
+              execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+                  private_data);
+            }
+          }
+        });
+  }
+};
+
+
+/////////
+// Collapsing three loops
+/////////
+
+/*!
+ * As for two loops, with a tbb::blocked_range3d.
+ */
+template <bool Affinity,
+          std::size_t... GrainSizes,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<policy::tbb::tbb_collapse<Affinity, GrainSizes...>,
+                        ArgList<Arg0, Arg1, Arg2>,
+                        EnclosedStmts...>,
+    Types> {
+
+  static_assert(sizeof...(GrainSizes) == 0 || sizeof...(GrainSizes) == 3,
+                "tbb collapse policy needs one grain size per loop");
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const std::size_t l0 = segment_length<Arg0>(data);
+    const std::size_t l1 = segment_length<Arg1>(data);
+    const std::size_t l2 = segment_length<Arg2>(data);
+
+    // Set the argument types for this loop
+    using NewTypes =
+        typename CollapseSegmentTypes<Types, Data, Arg0, Arg1, Arg2>::type;
+
+    using brange = ::tbb::blocked_range3d<std::size_t>;
+    const brange range(0, l0, detail::tbb_collapse_grain<GrainSizes...>(0),
+                       0, l1, detail::tbb_collapse_grain<GrainSizes...>(1),
+                       0, l2, detail::tbb_collapse_grain<GrainSizes...>(2));
+
+    detail::tbb_collapse_for(
+        std::integral_constant<bool, Affinity>{}, range, [&](const brange& r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(data);
+          auto& private_data = privatizer.get_priv();
+          for (auto i0 = r.pages().begin(); i0 != r.pages().end(); ++i0) {
+            for (auto i1 = r.rows().begin(); i1 != r.rows().end(); ++i1) {
+              for (auto i2 = r.cols().begin(); i2 != r.cols().end(); ++i2) {
+                private_data.template assign_offset<Arg0>(
+                    static_cast<segment_diff_type<Arg0, camp::decay<Data>>>(i0));
+                private_data.template assign_offset<Arg1>(
+                    static_cast<segment_diff_type<Arg1, camp::decay<Data>>>(i1));
+                private_data.template assign_offset<Arg2>(
+                    static_cast<segment_diff_type<Arg2, camp::decay<Data>>>(i2));
+                execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+                    private_data);
+              }
+            }
+          }
+        });
+  }
+};
+
+
+/////////
+// Collapsing an arbitrary number of loops
+/////////
+
+/*!
+ * Generic collapse used for any loop nest not covered by the two and three
+ * argument specializations above.
+ *
+ * The product space of the collapsed loops is linearized into a
+ * tbb::blocked_range whose grain size is the product of the grain sizes.
+ * Each task recovers the indices of its first iteration with one divide per
+ * loop and then advances them like an odometer.
+ */
+template <bool Affinity,
+          std::size_t... GrainSizes,
+          camp::idx_t... Args,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<policy::tbb::tbb_collapse<Affinity, GrainSizes...>,
+                        ArgList<Args...>,
+                        EnclosedStmts...>,
+    Types> {
+
+  static constexpr camp::idx_t num_args = sizeof...(Args);
+
+  static_assert(sizeof...(GrainSizes) == 0 ||
+                    sizeof...(GrainSizes) == sizeof...(Args),
+                "tbb collapse policy needs one grain size per loop");
+
+  template <typename Data, camp::idx_t... Dims>
+  static RAJA_INLINE void assign_offsets(Data& data,
+                                         Index_type const* idx,
+                                         camp::idx_seq<Dims...>)
+  {
+    camp::sink((data.template assign_offset<Args>(
+                    static_cast<segment_diff_type<Args, camp::decay<Data>>>(
+                        idx[Dims])),
+                0)...);
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const Index_type lengths[num_args] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
+
+    Index_type total = 1;
+    std::size_t grain = 1;
+    for (camp::idx_t d = 0; d < num_args; ++d) {
+      total *= lengths[d];
+      grain *= detail::tbb_collapse_grain<GrainSizes...>(d);
+    }
+    if (total <= 0) {
+      return;
+    }
+
+    // Set the argument types for this loop
+    using NewTypes =
+        typename CollapseSegmentTypes<Types, Data, Args...>::type;
+
+    using brange = ::tbb::blocked_range<Index_type>;
+    detail::tbb_collapse_for(
+        std::integral_constant<bool, Affinity>{},
+        brange(0, total, grain),
+        [&](const brange& r) {
+          Index_type idx[num_args];
+          Index_type rem = r.begin();
+          for (camp::idx_t d = num_args - 1; d >= 0; --d) {
+            idx[d] = rem % lengths[d];
+            rem /= lengths[d];
+          }
+
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(data);
+          auto& private_data = privatizer.get_priv();
+          for (Index_type i = r.begin(); i != r.end(); ++i) {
+            assign_offsets(private_data,
+                           idx,
+                           camp::make_idx_seq_t<num_args>{});
+            execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+                private_data);
+
+            // advance the innermost index, carrying into the outer ones
+            for (camp::idx_t d = num_args - 1;
+                 d >= 0 && ++idx[d] == lengths[d];
+                 --d) {
+              idx[d] = 0;
+            }
+          }
+        });
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
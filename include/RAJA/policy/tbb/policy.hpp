@@ -19,6 +19,7 @@
 #define policy_tbb_HPP
 
 #include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/affinity_schedule.hpp"
 
 #include <cstddef>
 
@@ -60,6 +61,51 @@ struct tbb_for_static : make_policy_pattern_launch_platform_t<Policy::tbb,
 
 using tbb_for_exec = tbb_for_static<>;
 
+///
+/// tbb::affinity_partitioner policy, replaying the mapping of subranges to
+/// worker threads kept by an affinity_schedule shared with earlier loops.
+///
+struct tbb_for_affinity
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  affinity_schedule schedule;
+  std::size_t grain_size;
+  tbb_for_affinity(affinity_schedule schedule_ = affinity_schedule{},
+                   std::size_t grain_size_ = 1)
+      : schedule(schedule_), grain_size(grain_size_)
+  {
+  }
+};
+
+///
+/// Kernel collapse policies, with the grain size of each collapsed loop.
+/// Affinity selects tbb::affinity_partitioner over tbb::auto_partitioner.
+///
+template <bool Affinity, std::size_t... GrainSizes>
+struct tbb_collapse : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                                            Pattern::forall,
+                                                            Launch::undefined,
+                                                            Platform::host> {
+};
+
+template <std::size_t... GrainSizes>
+using tbb_parallel_collapse_exec = tbb_collapse<false, GrainSizes...>;
+
+template <std::size_t... GrainSizes>
+using tbb_parallel_collapse_affinity_exec = tbb_collapse<true, GrainSizes...>;
+
+///
+///  Struct supporting TBB task parallelism for Teams
+///
+struct tbb_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 /// Index set segment iteration policies
 ///
@@ -91,13 +137,21 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
 }  // namespace tbb
 }  // namespace policy
 
+using policy::tbb::tbb_for_affinity;
 using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
+using policy::tbb::tbb_parallel_collapse_affinity_exec;
+using policy::tbb::tbb_parallel_collapse_exec;
 using policy::tbb::tbb_reduce;
 using policy::tbb::tbb_segit;
 using policy::tbb::tbb_work;
 
+namespace expt
+{
+  using policy::tbb::tbb_launch_t;
+}
+
 }  // namespace RAJA
 
 #endif
@@ -0,0 +1,358 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing user interface for RAJA::Teams::tbb
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_tbb_HPP
+#define RAJA_pattern_teams_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include <cstddef>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+template <>
+struct LaunchExecute<RAJA::expt::tbb_launch_t> {
+
+  //
+  // The launch body runs on the calling thread; parallelism comes from the
+  // tbb_for team and thread loops inside it, which TBB schedules with work
+  // stealing.  Teams may run on any worker thread, so scratch memory is
+  // taken from the executing thread's buffer.
+  //
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    LaunchContext tbb_ctx(ctx);
+    tbb_ctx.host_thread_shared_mem = true;
+
+    body(tbb_ctx);
+  }
+
+  template <typename BODY>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
+  {
+    exec(ctx, body);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+namespace detail
+{
+
+//
+// Grain size and partitioner of the parallel_for behind a tbb_for loop
+//
+template <typename POLICY>
+struct TbbLoopTraits;
+
+template <>
+struct TbbLoopTraits<RAJA::tbb_for_dynamic> {
+  using partitioner = ::tbb::auto_partitioner;
+  static std::size_t grain_size() { return RAJA::tbb_for_dynamic{}.grain_size; }
+};
+
+template <std::size_t GrainSize>
+struct TbbLoopTraits<RAJA::tbb_for_static<GrainSize>> {
+  using partitioner = RAJA::tbb_static_partitioner;
+  static std::size_t grain_size() { return GrainSize; }
+};
+
+//
+// Run one task of a tbb_for loop.  A thread waiting on the nested loops of
+// its task may only steal work spawned by that task, so it never starts
+// another team while holding the team scratch memory of the current one.
+//
+template <typename FUNC>
+RAJA_INLINE void tbb_loop_task(FUNC const &func)
+{
+#if TBB_VERSION_MAJOR >= 2018
+  ::tbb::this_task_arena::isolate(func);
+#else
+  func();
+#endif
+}
+
+//
+// Parallel loops over one, two and three dimensional ranges of loop
+// iterations.  Two and three dimensional ranges are split along their
+// longest dimension, so the tasks of a collapsed team or thread loop nest
+// stay roughly square.  Dimension 0 is the innermost loop.
+//
+template <typename POLICY>
+struct TbbLoop {
+
+  using traits = TbbLoopTraits<POLICY>;
+
+  template <typename FUNC>
+  static RAJA_INLINE void exec(int len, FUNC const &func)
+  {
+    using brange = ::tbb::blocked_range<int>;
+    ::tbb::parallel_for(
+        brange(0, len, traits::grain_size()),
+        [&](const brange &r) {
+          tbb_loop_task([&]() {
+            using RAJA::internal::thread_privatize;
+            auto privatizer = thread_privatize(func);
+            auto &body = privatizer.get_priv();
+            for (int i = r.begin(); i != r.end(); ++i) {
+              body(i);
+            }
+          });
+        },
+        typename traits::partitioner{});
+  }
+
+  template <typename FUNC>
+  static RAJA_INLINE void exec(int len0, int len1, FUNC const &func)
+  {
+    using brange = ::tbb::blocked_range2d<int>;
+    ::tbb::parallel_for(
+        brange(0, len1, traits::grain_size(), 0, len0, traits::grain_size()),
+        [&](const brange &r) {
+          tbb_loop_task([&]() {
+            using RAJA::internal::thread_privatize;
+            auto privatizer = thread_privatize(func);
+            auto &body = privatizer.get_priv();
+            for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+              for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+                body(i, j);
+              }
+            }
+          });
+        },
+        typename traits::partitioner{});
+  }
+
+  template <typename FUNC>
+  static RAJA_INLINE void exec(int len0, int len1, int len2, FUNC const &func)
+  {
+    using brange = ::tbb::blocked_range3d<int>;
+    ::tbb::parallel_for(
+        brange(0, len2, traits::grain_size(),
+               0, len1, traits::grain_size(),
+               0, len0, traits::grain_size()),
+        [&](const brange &r) {
+          tbb_loop_task([&]() {
+            using RAJA::internal::thread_privatize;
+            auto privatizer = thread_privatize(func);
+            auto &body = privatizer.get_priv();
+            for (int k = r.pages().begin(); k != r.pages().end(); ++k) {
+              for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+                for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+                  body(i, j, k);
+                }
+              }
+            }
+          });
+        },
+        typename traits::partitioner{});
+  }
+};
+
+template <typename POLICY, typename SEGMENT>
+struct TbbLoopExecute {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    TbbLoop<POLICY>::exec(len, [=](int i) { body(*(segment.begin() + i)); });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    TbbLoop<POLICY>::exec(len0, len1, [=](int i, int j) {
+      body(*(segment0.begin() + i), *(segment1.begin() + j));
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    TbbLoop<POLICY>::exec(len0, len1, len2, [=](int i, int j, int k) {
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           *(segment2.begin() + k));
+    });
+  }
+};
+
+template <typename POLICY, typename SEGMENT>
+struct TbbLoopICountExecute {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    TbbLoop<POLICY>::exec(len, [=](int i) { body(*(segment.begin() + i), i); });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    TbbLoop<POLICY>::exec(len0, len1, [=](int i, int j) {
+      body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    TbbLoop<POLICY>::exec(len0, len1, len2, [=](int i, int j, int k) {
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           *(segment2.begin() + k),
+           i,
+           j,
+           k);
+    });
+  }
+};
+
+template <typename POLICY, typename SEGMENT>
+struct TbbTileExecute {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    const int num_tiles = (len + tile_size - 1) / tile_size;
+    TbbLoop<POLICY>::exec(num_tiles, [=](int bx) {
+      body(segment.slice(bx * tile_size, tile_size));
+    });
+  }
+};
+
+template <typename POLICY, typename SEGMENT>
+struct TbbTileICountExecute {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    const int num_tiles = (len + tile_size - 1) / tile_size;
+    TbbLoop<POLICY>::exec(num_tiles, [=](int bx) {
+      body(segment.slice(bx * tile_size, tile_size), bx);
+    });
+  }
+};
+
+}  // namespace detail
+
+//
+// tbb_for loops may be used at both the team and the thread level; nested
+// loops become nested parallel_for calls
+//
+template <typename SEGMENT>
+struct LoopExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TbbLoopExecute<tbb_for_dynamic, SEGMENT> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct LoopExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbLoopExecute<tbb_for_static<GrainSize>, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TbbLoopICountExecute<tbb_for_dynamic, SEGMENT> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct LoopICountExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbLoopICountExecute<tbb_for_static<GrainSize>, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TbbTileExecute<tbb_for_dynamic, SEGMENT> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct TileExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbTileExecute<tbb_for_static<GrainSize>, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TbbTileICountExecute<tbb_for_dynamic, SEGMENT> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct TileICountExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbTileICountExecute<tbb_for_static<GrainSize>, SEGMENT> {
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_TBB)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,204 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining FastDivisor, which replaces integer
+ *          division by an invariant divisor with a multiply and shift.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_FAST_DIVIDE_HPP
+#define RAJA_FAST_DIVIDE_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+#if defined(RAJA_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 fast_divide_uint128;
+#endif
+
+/*!
+ * Upper 64 bits of the 128-bit product of a and b
+ */
+RAJA_INLINE RAJA_HOST_DEVICE uint64_t mulhi64(uint64_t a, uint64_t b)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __umul64hi(a, b);
+#elif defined(__SIZEOF_INT128__)
+  return static_cast<uint64_t>((fast_divide_uint128(a) * b) >> 64);
+#elif defined(RAJA_COMPILER_MSVC) && defined(_M_X64)
+  return __umulh(a, b);
+#else
+  const uint64_t a_lo = a & 0xffffffffu, a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xffffffffu, b_hi = b >> 32;
+  const uint64_t lo_lo = a_lo * b_lo;
+  const uint64_t hi_lo = a_hi * b_lo;
+  const uint64_t lo_hi = a_lo * b_hi;
+  const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+  return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+/*!
+ * Smallest l with 2^l >= d, for d >= 1
+ */
+RAJA_INLINE RAJA_HOST_DEVICE constexpr int ceilLog2(uint64_t d)
+{
+  int l = 0;
+  while (l < 64 && (uint64_t(1) << l) < d) {
+    ++l;
+  }
+  return l;
+}
+
+/*!
+ * ceil(2^k / d) for 1 <= d, k < 64 + ceilLog2(d), so the result fits in
+ * 64 bits
+ */
+RAJA_INLINE RAJA_HOST_DEVICE constexpr uint64_t ceilPow2Div(int k, uint64_t d)
+{
+#if defined(__SIZEOF_INT128__) && !defined(RAJA_DEVICE_CODE)
+  return static_cast<uint64_t>(((fast_divide_uint128(1) << k) - 1) / d) + 1;
+#else
+  // long division of 2^k - 1, whose bits are all ones; the leading
+  // ceilLog2(d) - 1 bits leave a remainder below d and a zero quotient
+  const int l = ceilLog2(d);
+  const int skip = l > 0 ? l - 1 : 0;
+  uint64_t r = (uint64_t(1) << skip) - 1;
+  uint64_t q = 0;
+  for (int i = skip; i < k; ++i) {
+    r = 2 * r + 1;
+    q <<= 1;
+    if (r >= d) {
+      r -= d;
+      q |= 1;
+    }
+  }
+  return q + 1;
+#endif
+}
+
+/*!
+ * @brief Invariant integer divisor that divides by a multiply and shift.
+ *
+ * The multiplier and shift are computed once, at construction, following
+ * T. Granlund and P. Montgomery, "Division by invariant integers using
+ * multiplication", PLDI 1994: with l = ceil(log2(d)) and k = N + l, the
+ * multiplier m = ceil(2^k / d) gives n / d == (n * m) >> k for all
+ * 0 <= n < 2^N. Signed types of 32 bits or less, and unsigned types of
+ * less than 32 bits, use N = 31 and a 64-bit product; other types use
+ * N = 63 and the upper half of a 128-bit product. Unsigned 32-bit types
+ * take the wide path because their dividends reach 2^32, where the
+ * multiplier and the product would no longer fit in 32 and 64 bits.
+ *
+ * Dividends must be nonnegative and below 2^dividend_bits, the smaller of N
+ * and the number of value bits of T, which holds for the linear indices of
+ * a Layout. The divisor must be positive; zero and negative divisors are
+ * replaced by 1.
+ *
+ * A FastDivisor converts from and to its divisor, so it may stand in for an
+ * integer that is only ever used as a divisor.
+ */
+template <typename T>
+struct FastDivisor {
+  static_assert(std::is_integral<T>::value,
+                "FastDivisor requires an integral type");
+
+  static constexpr bool is_narrow =
+      sizeof(T) < 4 || (sizeof(T) == 4 && std::is_signed<T>::value);
+
+  using word_type =
+      typename std::conditional<is_narrow, uint32_t, uint64_t>::type;
+
+  //! N of the multiply-shift, and the bits of the dividends it divides
+  static constexpr int product_bits = is_narrow ? 31 : 63;
+  static constexpr int dividend_bits =
+      product_bits < std::numeric_limits<T>::digits
+          ? product_bits
+          : std::numeric_limits<T>::digits;
+
+  T divisor;
+  word_type multiplier;
+  int shift;
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivisor() : FastDivisor(T(1)) {}
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivisor(T d)
+      : divisor(d > T(0) ? d : T(1)),
+        multiplier(static_cast<word_type>(
+            ceilPow2Div(product_bits + ceilLog2(uint64_t(divisor)),
+                        uint64_t(divisor)))),
+        shift(is_narrow ? product_bits + ceilLog2(uint64_t(divisor))
+                        : ceilLog2(uint64_t(divisor)))
+  {
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr operator T() const { return divisor; }
+
+  /*!
+   * Quotient n / divisor, for 0 <= n < 2^dividend_bits
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE T divide(T n) const
+  {
+    return divideImpl(n, std::integral_constant<bool, is_narrow>{});
+  }
+
+  /*!
+   * Remainder n % divisor, for 0 <= n < 2^dividend_bits
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE T modulo(T n) const
+  {
+    return static_cast<T>(n - divide(n) * divisor);
+  }
+
+private:
+  RAJA_INLINE RAJA_HOST_DEVICE T divideImpl(T n, std::true_type) const
+  {
+    return static_cast<T>((uint64_t(static_cast<uint32_t>(n)) * multiplier) >>
+                          shift);
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE T divideImpl(T n, std::false_type) const
+  {
+    // (n * m) >> (63 + l) as the upper half of (2 * n) * m, shifted by l
+    return static_cast<T>(
+        mulhi64(static_cast<uint64_t>(n) << 1, multiplier) >> shift);
+  }
+};
+
+template <typename T>
+constexpr bool FastDivisor<T>::is_narrow;
+template <typename T>
+constexpr int FastDivisor<T>::product_bits;
+template <typename T>
+constexpr int FastDivisor<T>::dividend_bits;
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -28,6 +28,7 @@
 
 #include "RAJA/internal/foldl.hpp"
 
+#include "RAJA/util/FastDivide.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
 
@@ -80,8 +81,9 @@ public:
 
   IdxLin sizes[n_dims] = {0};
   IdxLin strides[n_dims] = {0};
-  IdxLin inv_strides[n_dims] = {0};
-  IdxLin inv_mods[n_dims] = {0};
+  // divisors of toIndices, with precomputed multiply-shift constants
+  FastDivisor<IdxLin> inv_strides[n_dims];
+  FastDivisor<IdxLin> inv_mods[n_dims];
 
 
   /*!
@@ -196,7 +198,10 @@ public:
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * Each index is (linear_index / stride) % size. Both divisors are fixed
+   * when the layout is constructed, so each division is done by a multiply
+   * and shift with precomputed constants rather than a divide instruction.
+   * The linear_index must lie in [0, size()).
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
@@ -216,8 +221,8 @@ public:
      }
 #endif
 
-    camp::sink((indices = (camp::decay<Indices>)((linear_index / inv_strides[RangeInts]) %
-                                   inv_mods[RangeInts]))...);
+    camp::sink((indices = (camp::decay<Indices>)(inv_mods[RangeInts].modulo(
+                    inv_strides[RangeInts].divide(linear_index))))...);
   }
 
   /*!
@@ -338,7 +343,7 @@ struct TypedLayout<IdxLin, camp::tuple<DimTypes...>, StrideOne>
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * Note that this operation requires 2n integer multiply-shift operations
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
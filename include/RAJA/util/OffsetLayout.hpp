@@ -106,6 +106,19 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
     return base_((indices - offsets[RangeInts])...);
   }
 
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices, offsets
+   * included. See LayoutBase_impl::toIndices.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    base_.toIndices(linear_index, indices...);
+    camp::sink((indices = (camp::decay<Indices>)(stripIndexType(indices) +
+                                                 offsets[RangeInts]))...);
+  }
+
   static RAJA_INLINE OffsetLayout_impl<IndexRange, IdxLin>
   from_layout_and_offsets(
       const std::array<IdxLin, sizeof...(RangeInts)>& offsets_in,
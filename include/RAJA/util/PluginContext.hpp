@@ -8,10 +8,51 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
 namespace RAJA {
+
+namespace detail {
+
+/*!
+ * \brief Returns a human-readable name for type T.
+ *
+ * The name is computed once per type and cached, so the returned pointer is
+ * stable for the lifetime of the program and is cheap to obtain on every
+ * kernel launch.
+ */
+template <typename T>
+const char* type_name()
+{
+  static const std::string name = [] {
+    const char* mangled = typeid(T).name();
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr) {
+      std::string result(demangled);
+      std::free(demangled);
+      return result;
+    }
+#endif
+    return std::string(mangled);
+  }();
+  return name.c_str();
+}
+
+}  // namespace detail
+
 namespace util {
 
 class KokkosPluginLoader;
@@ -21,8 +62,26 @@ struct PluginContext {
     PluginContext(const Platform p) :
       platform(p) {}
 
+    PluginContext(const Platform p,
+                  const char* kernel,
+                  const char* policy,
+                  size_t size) :
+      platform(p),
+      kernel_name(kernel),
+      policy_name(policy),
+      iteration_size(size) {}
+
     Platform platform;
 
+    //! Name of the launched kernel (user supplied, or the loop body type)
+    const char* kernel_name{nullptr};
+
+    //! Name of the execution policy type used for the launch
+    const char* policy_name{nullptr};
+
+    //! Total number of iterations in the launched iteration space
+    size_t iteration_size{0};
+
   private:
     mutable uint64_t kID;
 
@@ -35,6 +94,23 @@ PluginContext make_context()
   return PluginContext{detail::get_platform<Policy>::value};
 }
 
+/*!
+ * \brief Make a context describing a kernel launch.
+ *
+ * If kernel_name is null the demangled type name of Body is used, so that
+ * unnamed launches of the same lambda are still grouped together.
+ */
+template<typename Policy, typename Body>
+PluginContext make_context(size_t iteration_size,
+                           const char* kernel_name = nullptr)
+{
+  return PluginContext{detail::get_platform<Policy>::value,
+                       kernel_name ? kernel_name
+                                   : RAJA::detail::type_name<Body>(),
+                       RAJA::detail::type_name<Policy>(),
+                       iteration_size};
+}
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
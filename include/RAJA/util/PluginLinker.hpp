@@ -8,15 +8,28 @@
 #ifndef RAJA_Plugin_Linker_HPP
 #define RAJA_Plugin_Linker_HPP
 
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
 #include "RAJA/util/RuntimePluginLoader.hpp"
 #include "RAJA/util/KokkosPluginLoader.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_TRACE_PLUGIN)
+#include "RAJA/util/TracePlugin.hpp"
+#endif
 
 namespace {
   namespace anonymous_RAJA {
     struct pluginLinker {
       inline pluginLinker() {
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
         (void)RAJA::util::linkRuntimePluginLoader();
         (void)RAJA::util::linkKokkosPluginLoader();
+#endif
+#if defined(RAJA_ENABLE_TRACE_PLUGIN)
+        (void)RAJA::util::linkTracePlugin();
+#endif
       }
     } pluginLinker;
   }
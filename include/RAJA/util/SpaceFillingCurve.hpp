@@ -0,0 +1,357 @@
+/*!
+ ******************************************************************************
+ *
+ * \file SpaceFillingCurve.hpp
+ *
+ * \brief   Header file containing methods that renumber data and index sets
+ *          along a space-filling curve through point coordinates.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SpaceFillingCurve_HPP
+#define RAJA_SpaceFillingCurve_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/util/Span.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//
+// Morton key of a point with the given number of bits per coordinate:
+// the coordinate bits interleaved from the most significant down
+//
+template <size_t N>
+RAJA_INLINE uint64_t curveKey(box_order::morton,
+                              uint64_t (&x)[N],
+                              int bits)
+{
+  uint64_t key = 0;
+  for (int b = bits - 1; b >= 0; --b) {
+    for (size_t d = 0; d < N; ++d) {
+      key = (key << 1) | ((x[d] >> b) & 1);
+    }
+  }
+  return key;
+}
+
+//
+// Hilbert key of a point with the given number of bits per coordinate.
+// The coordinates are transformed in place to the transposed Hilbert index
+// of J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707
+// (2004), whose bits are then interleaved as for a Morton key.
+//
+template <size_t N>
+RAJA_INLINE uint64_t curveKey(box_order::hilbert,
+                              uint64_t (&x)[N],
+                              int bits)
+{
+  const uint64_t top = uint64_t(1) << (bits - 1);
+
+  for (uint64_t q = top; q > 1; q >>= 1) {
+    const uint64_t p = q - 1;
+    for (size_t d = 0; d < N; ++d) {
+      if (x[d] & q) {
+        x[0] ^= p;
+      } else {
+        const uint64_t t = (x[0] ^ x[d]) & p;
+        x[0] ^= t;
+        x[d] ^= t;
+      }
+    }
+  }
+
+  for (size_t d = 1; d < N; ++d) {
+    x[d] ^= x[d - 1];
+  }
+  uint64_t t = 0;
+  for (uint64_t q = top; q > 1; q >>= 1) {
+    if (x[N - 1] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (size_t d = 0; d < N; ++d) {
+    x[d] ^= t;
+  }
+
+  return curveKey(box_order::morton{}, x, bits);
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Compute the space-filling curve key of each of a set of points.
+ *
+ * \tparam ExecPolicy host execution policy used for the key computation
+ * \tparam Order RAJA::box_order::morton or RAJA::box_order::hilbert
+ *
+ * \param coords array of point coordinates for each dimension
+ * \param len number of points
+ * \param keys array of len keys computed
+ *
+ * The bounding box of the points is divided into a grid of 2^(64/N) cells
+ * per dimension, at most 2^32, and each point gets the curve key of its
+ * cell. Points in the same cell get the same key.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Order, typename Real, size_t N>
+void computeCurveKeys(const std::array<const Real*, N>& coords,
+                      Index_type len,
+                      uint64_t* keys)
+{
+  static_assert(N > 0 && N <= 64,
+                "computeCurveKeys supports 1 to 64 dimensions");
+
+  if (len <= 0) return;
+
+  //
+  // Bounding box, from the bounds of chunks of the points found in parallel
+  //
+  const Index_type num_chunks = std::min<Index_type>(len, 256);
+  std::vector<Real> chunk_lower(num_chunks * N);
+  std::vector<Real> chunk_upper(num_chunks * N);
+  Real* lower_ptr = chunk_lower.data();
+  Real* upper_ptr = chunk_upper.data();
+
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, num_chunks),
+                     [=](Index_type c) {
+    const Index_type first = len * c / num_chunks;
+    const Index_type last = len * (c + 1) / num_chunks;
+    for (size_t d = 0; d < N; ++d) {
+      Real lo = coords[d][first];
+      Real hi = coords[d][first];
+      for (Index_type i = first + 1; i < last; ++i) {
+        lo = std::min(lo, coords[d][i]);
+        hi = std::max(hi, coords[d][i]);
+      }
+      lower_ptr[c * N + d] = lo;
+      upper_ptr[c * N + d] = hi;
+    }
+  });
+
+  const int bits = static_cast<int>(std::min<size_t>(64 / N, 32));
+  const double max_cell = static_cast<double>((uint64_t(1) << bits) - 1);
+
+  std::array<double, N> lower;
+  std::array<double, N> scale;
+  for (size_t d = 0; d < N; ++d) {
+    Real lo = lower_ptr[d];
+    Real hi = upper_ptr[d];
+    for (Index_type c = 1; c < num_chunks; ++c) {
+      lo = std::min(lo, lower_ptr[c * N + d]);
+      hi = std::max(hi, upper_ptr[c * N + d]);
+    }
+    lower[d] = static_cast<double>(lo);
+    scale[d] = (hi > lo) ? max_cell / (static_cast<double>(hi) - lower[d])
+                         : 0.0;
+  }
+
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+                     [=](Index_type i) {
+    uint64_t x[N];
+    for (size_t d = 0; d < N; ++d) {
+      const double cell = (static_cast<double>(coords[d][i]) - lower[d]) *
+                          scale[d];
+      x[d] = static_cast<uint64_t>(std::min(cell, max_cell));
+    }
+    keys[i] = detail::curveKey(Order{}, x, bits);
+  });
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Compute the permutation that orders a set of points along a
+ *         space-filling curve.
+ *
+ * \tparam ExecPolicy host execution policy used for the keys and the sort
+ * \tparam Order RAJA::box_order::morton or RAJA::box_order::hilbert
+ *
+ * \param coords array of point coordinates for each dimension
+ * \param len number of points
+ * \param perm array of len entries; on return, perm[i] is the old number of
+ *        the point that has new number i
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Order, typename Real, size_t N>
+void computeCurvePermutation(const std::array<const Real*, N>& coords,
+                             Index_type len,
+                             Index_type* perm)
+{
+  if (len <= 0) return;
+
+  std::vector<uint64_t> keys(len);
+  computeCurveKeys<ExecPolicy, Order>(coords, len, keys.data());
+
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+                     [=](Index_type i) { perm[i] = i; });
+
+  sort_pairs<ExecPolicy>(make_span(keys.data(), len), make_span(perm, len));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Invert a permutation, so that inv[perm[i]] = i.
+ *
+ *         The inverse of a permutation from computeCurvePermutation maps the
+ *         old number of each point to its new number.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy>
+void invertPermutation(const Index_type* perm, Index_type len, Index_type* inv)
+{
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+                     [=](Index_type i) { inv[perm[i]] = i; });
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Copy array data into the new numbering, so that
+ *         out[i] = in[perm[i]].
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename T>
+void permuteArray(const Index_type* perm, Index_type len, const T* in, T* out)
+{
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, len),
+                     [=](Index_type i) { out[i] = in[perm[i]]; });
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Return a list segment holding the new numbers of the indices of
+ *         the given segment, in increasing order.
+ *
+ * \param seg segment whose indices live in host memory space
+ * \param inv inverse permutation, mapping old to new index numbers
+ * \param work_res camp resource defining memory space where the new list
+ *        segment index data live
+ *
+ * The new indices are sorted, so a loop over the segment visits them in
+ * curve order.
+ *
+ ******************************************************************************
+ */
+template <typename SegmentType>
+TypedListSegment<typename SegmentType::IndexType> renumberSegment(
+    const SegmentType& seg,
+    const Index_type* inv,
+    camp::resources::Resource work_res)
+{
+  using IndexType = typename SegmentType::IndexType;
+
+  std::vector<IndexType> indices;
+  indices.reserve(seg.size());
+  for (auto idx : seg) {
+    indices.push_back(static_cast<IndexType>(inv[idx]));
+  }
+  std::sort(indices.begin(), indices.end());
+
+  return TypedListSegment<IndexType>(indices, work_res);
+}
+
+namespace detail
+{
+
+//
+// Gathers the new numbers of the indices of a segment of an index set
+//
+struct RenumberSegmentIndices {
+  template <typename SegmentType>
+  void operator()(const SegmentType& seg,
+                  const Index_type* inv,
+                  std::vector<Index_type>& indices) const
+  {
+    for (auto idx : seg) {
+      indices.push_back(inv[idx]);
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Generate an index set with the new numbers of the indices of each
+ *         segment of the given index set.
+ *
+ *  \param iset reference to index set generated. Method assumes index set
+ *         is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *  \param in index set whose segment indices live in host memory space.
+ *  \param inv inverse permutation, mapping old to new index numbers.
+ *
+ *  Each segment of the given index set becomes one segment of the generated
+ *  index set, holding its new index numbers in increasing order. Segments
+ *  whose new numbers are contiguous become range segments; all others
+ *  become list segments.
+ *
+ ******************************************************************************
+ */
+template <typename... SegmentTypes>
+void renumberIndexSet(
+    TypedIndexSet<RangeSegment, ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const TypedIndexSet<SegmentTypes...>& in,
+    const Index_type* inv)
+{
+  std::vector<Index_type> indices;
+  for (size_t segid = 0; segid < in.getNumSegments(); ++segid) {
+    indices.clear();
+    in.segmentCall(segid, detail::RenumberSegmentIndices{}, inv, indices);
+    std::sort(indices.begin(), indices.end());
+
+    if (!indices.empty() &&
+        indices.back() - indices.front() + 1 ==
+            static_cast<Index_type>(indices.size()) &&
+        std::adjacent_find(indices.begin(), indices.end()) == indices.end()) {
+      iset.push_back(RangeSegment(indices.front(), indices.back() + 1));
+    } else {
+      iset.push_back(ListSegment(indices, work_res));
+    }
+  }
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,146 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Trace_Plugin_HPP
+#define RAJA_Trace_Plugin_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * \brief Log-linear histogram of durations in the style of HdrHistogram.
+   *
+   * Every power-of-two range of values is split into a fixed number of
+   * linear sub-buckets, so values are recorded with a bounded relative error
+   * (about 6%) over the whole 64-bit range using a small fixed-size array.
+   */
+  class TraceHistogram
+  {
+  public:
+    static constexpr int sub_bucket_bits = 4;
+    static constexpr size_t sub_bucket_count = size_t(1) << sub_bucket_bits;
+    static constexpr size_t bucket_count =
+        (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+    void record(uint64_t value);
+
+    uint64_t count() const { return total_count; }
+    uint64_t min() const { return total_count ? min_value : 0; }
+    uint64_t max() const { return max_value; }
+    uint64_t sum() const { return total_sum; }
+    double mean() const;
+
+    //! Value below which the given fraction (0 to 1) of samples fall
+    uint64_t percentile(double fraction) const;
+
+    uint64_t bucketCount(size_t index) const { return counts[index]; }
+
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketLowerBound(size_t index);
+
+  private:
+    std::array<uint64_t, bucket_count> counts{};
+    uint64_t total_count{0};
+    uint64_t total_sum{0};
+    uint64_t min_value{~uint64_t(0)};
+    uint64_t max_value{0};
+  };
+
+  /*!
+   * \brief Plugin recording the duration of every forall, kernel and launch.
+   *
+   * Launches are grouped by kernel name and policy, each group keeping a
+   * TraceHistogram of its durations. At finalize() (or program exit) the
+   * individual launches are written as Chrome trace "complete" events,
+   * together with a per-kernel summary, to the file named by the
+   * RAJA_TRACE_FILE environment variable (raja-trace.json by default). The
+   * number of individual events kept is bounded by RAJA_TRACE_MAX_EVENTS;
+   * histograms are always updated.
+   */
+  class TracePlugin : public RAJA::util::PluginStrategy
+  {
+  public:
+    TracePlugin();
+
+    ~TracePlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    struct KernelRecord {
+      KernelRecord(const char* n, const char* pol, RAJA::Platform p)
+          : name(n), policy(pol), platform(p)
+      {
+      }
+
+      std::string name;
+      std::string policy;
+      RAJA::Platform platform;
+      uint64_t iterations{0};
+      TraceHistogram histogram;
+    };
+
+    struct Event {
+      size_t kernel;
+      uint64_t start;
+      uint64_t duration;
+      size_t size;
+      int thread;
+    };
+
+    struct PointerPairHash {
+      size_t operator()(const std::pair<const char*, const char*>& p) const;
+    };
+
+    size_t lookup(const RAJA::util::PluginContext& p);
+
+    void write(std::ostream& os) const;
+
+    uint64_t now() const;
+
+    std::mutex mutex;
+    clock::time_point epoch;
+    std::string filename;
+    size_t max_events;
+    bool written{false};
+
+    std::vector<std::unique_ptr<KernelRecord>> kernels;
+    std::unordered_map<std::string, size_t> kernel_index;
+    std::unordered_map<std::pair<const char*, const char*>,
+                       size_t,
+                       PointerPairHash>
+        pointer_cache;
+    std::vector<Event> events;
+
+  };  // end TracePlugin class
+
+  void linkTracePlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
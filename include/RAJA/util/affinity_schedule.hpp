@@ -0,0 +1,171 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining affinity_schedule, which keeps the
+ *          thread that runs each part of a loop the same across loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_affinity_schedule_HPP
+#define RAJA_util_affinity_schedule_HPP
+
+#include "RAJA/config.hpp"
+
+#include <memory>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/tbb.h>
+#endif
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Record of which thread runs each part of a loop, replayed by later
+ * loops so every thread goes back to the data it touched before.
+ *
+ * A schedule is passed to the policy of each loop that shares it:
+ *
+ * \code
+ *
+ * RAJA::affinity_schedule sched;
+ *
+ * for (int step = 0; step < num_steps; ++step) {
+ *   RAJA::forall(RAJA::omp_parallel_for_affinity_exec(sched),
+ *                RAJA::RangeSegment(0, N), update);
+ *   RAJA::forall(RAJA::omp_parallel_for_affinity_exec(sched),
+ *                RAJA::RangeSegment(1, N - 1), stencil);
+ * }
+ *
+ * \endcode
+ *
+ * The first OpenMP loop run with the schedule records the block of
+ * iterations each thread runs under a static schedule, and later loops run
+ * the same blocks.  Over range segments the blocks are recorded as index
+ * values, so each index of the stencil loop above runs on the thread that
+ * updated it, which static schedules over the two segments would not do;
+ * indices before or after the recorded loop go to the first or last thread,
+ * so a range disjoint from the recorded one runs entirely on one of them.
+ * Over other segments the blocks are positions in the segment, recorded
+ * again when the segment length changes.  Blocks are also recorded again
+ * when the team size changes, or after reset().  A recording is made by the
+ * whole team of a loop at once, so every thread of a team replays blocks of
+ * the same recording.
+ *
+ * TBB loops run with the schedule share its tbb::affinity_partitioner,
+ * which replays the mapping of subranges to worker threads of the previous
+ * loop of the same length.
+ *
+ * Copies of a schedule share the record.  Loops using a schedule must not
+ * run at the same time, except as one worksharing loop of an OpenMP team.
+ */
+class affinity_schedule
+{
+public:
+  //! Iterations [first, last) recorded for one thread, as index values or
+  //! as positions in the recorded segment
+  struct Block {
+    Index_type first = 0;
+    Index_type last = 0;
+  };
+
+  //! Team size of the loop the blocks were recorded by, whether they hold
+  //! index values, and the length of its segment; num_threads is 0 when
+  //! nothing is recorded
+  struct Recording {
+    int num_threads = 0;
+    bool by_value = false;
+    Index_type length = 0;
+  };
+
+  explicit affinity_schedule(int max_threads = default_max_threads())
+      : state(std::make_shared<State>(max_threads > 0 ? max_threads : 1))
+  {
+  }
+
+  //! Largest team that can record blocks; larger teams run a static schedule
+  int max_threads() const { return state->num_blocks; }
+
+  //! Block of the given thread, only to be used by that thread in a loop
+  Block &block(int thread) const { return state->slots[thread].block; }
+
+  //! Recording the blocks belong to, only changed by one thread of a team
+  //! while the others wait
+  Recording &recording() const { return state->recording; }
+
+#if defined(RAJA_ENABLE_TBB)
+  ::tbb::affinity_partitioner &tbb_partitioner() const
+  {
+    return *state->partitioner;
+  }
+#endif
+
+  //! Forget the recorded mapping; not to be called while a loop uses it
+  void reset()
+  {
+    state->recording = Recording{};
+    for (int t = 0; t < state->num_blocks; ++t) {
+      state->slots[t].block = Block{};
+    }
+#if defined(RAJA_ENABLE_TBB)
+    state->partitioner.reset(new ::tbb::affinity_partitioner);
+#endif
+  }
+
+private:
+  // padded so the blocks of different threads never share a cache line
+  struct Slot {
+    Block block;
+    char padding[128 - sizeof(Block)];
+  };
+
+  struct State {
+    explicit State(int num_blocks_)
+        : num_blocks(num_blocks_),
+          slots(new Slot[num_blocks_])
+#if defined(RAJA_ENABLE_TBB)
+          ,
+          partitioner(new ::tbb::affinity_partitioner)
+#endif
+    {
+    }
+
+    int num_blocks;
+    Recording recording;
+    std::unique_ptr<Slot[]> slots;
+#if defined(RAJA_ENABLE_TBB)
+    std::unique_ptr<::tbb::affinity_partitioner> partitioner;
+#endif
+  };
+
+  static int default_max_threads()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  std::shared_ptr<State> state;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,144 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing NUMA-aware host memory allocation
+ *          and page placement methods.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_NUMA_ALLOCATOR_HPP
+#define RAJA_NUMA_ALLOCATOR_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+
+namespace numa
+{
+
+/*!
+ * \brief Placement of the pages of a NUMA allocation.
+ *
+ * first_touch -- each page is touched by the OpenMP thread whose static
+ *                partition of the allocation holds it, as in a loop with
+ *                omp_parallel_for_static_exec, so the kernel places it on
+ *                that thread's node.
+ * interleave  -- pages are spread round-robin over all nodes.
+ * bind        -- pages are placed on one given node.
+ */
+enum class placement { first_touch, interleave, bind };
+
+/*!
+ * \brief Return number of NUMA nodes of the machine, 1 if unknown.
+ */
+int RAJASHAREDDLL_API getNumNodes();
+
+/*!
+ * \brief Allocate page-aligned host memory and place its pages.
+ *
+ * \param nbytes number of bytes to allocate
+ * \param elem_size size of the array elements; the first_touch partition
+ *        splits the elements, not the bytes, among threads
+ * \param mode placement of the pages
+ * \param node node of the pages for the bind mode, ignored otherwise; it is
+ *        an error if it is not a node of the machine
+ *
+ * \return pointer to the memory, nullptr on failure
+ *
+ * Placement uses the Linux mbind system call directly, so libnuma is not
+ * required. Placement is best effort: where the system call is not
+ * available, or fails, the pages are placed by first touch. The memory is
+ * zeroed.
+ */
+void* RAJASHAREDDLL_API allocate(size_t nbytes,
+                                 size_t elem_size = 1,
+                                 placement mode = placement::first_touch,
+                                 int node = 0);
+
+/*!
+ * \brief Free memory returned by allocate.
+ */
+void RAJASHAREDDLL_API deallocate(void* ptr);
+
+/*!
+ * \brief Move the pages of existing memory to the given node.
+ *
+ * \return number of pages moved, or -1 if the pages cannot be moved
+ *
+ * Uses the Linux move_pages system call, so the memory need not come from
+ * allocate. Only pages that hold data are moved.
+ */
+long RAJASHAREDDLL_API movePages(void* ptr, size_t nbytes, int node);
+
+/*!
+ * \brief Return the node holding the page at ptr, -1 if unknown or if the
+ *        page holds no data yet.
+ */
+int RAJASHAREDDLL_API getNode(const void* ptr);
+
+/*!
+ * \brief Typed allocation of count elements of type T.
+ */
+template <typename T>
+T* allocate(size_t count,
+            placement mode = placement::first_touch,
+            int node = 0)
+{
+  return static_cast<T*>(allocate(count * sizeof(T), sizeof(T), mode, node));
+}
+
+/*!
+ * \brief Allocators for RAJA::basic_mempool::MemPool, with the interface of
+ *        basic_mempool::generic_allocator.
+ *
+ * A memory pool touches each chunk it allocates as one array, so the
+ * first_touch partition applies to the chunk, not to the arrays carved
+ * from it. Pools whose arrays are used by all threads should interleave.
+ */
+struct first_touch_allocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes) { return allocate(nbytes); }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    deallocate(ptr);
+    return true;
+  }
+};
+
+struct interleave_allocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    return allocate(nbytes, 1, placement::interleave);
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    deallocate(ptr);
+    return true;
+  }
+};
+
+} /* end namespace numa */
+
+} /* end namespace RAJA */
+
+#endif /* RAJA_NUMA_ALLOCATOR_HPP */
@@ -10,6 +10,9 @@
 
 #include "RAJA/config.hpp"
 
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/PluginStrategy.hpp"
@@ -28,52 +31,86 @@ RAJA_INLINE auto trigger_updates_before(T&& item)
   return item;
 }
 
+/*!
+ * \brief Returns true if any plugin has been registered.
+ *
+ * Launch methods check this once per launch and skip building a
+ * PluginContext and calling the hooks when no plugin is registered. It is
+ * always false when RAJA is configured with RAJA_ENABLE_PLUGINS=Off.
+ */
+RAJA_INLINE
+bool
+plugins_registered()
+{
+#if defined(RAJA_ENABLE_PLUGINS)
+  return PluginRegistry::begin() != PluginRegistry::end();
+#else
+  return false;
+#endif
+}
+
 RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGINS)
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preCapture(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGINS)
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->postCapture(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGINS)
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preLaunch(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGINS)
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->postLaunch(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
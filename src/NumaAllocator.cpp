@@ -0,0 +1,310 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for NUMA-aware host memory allocation.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/numa_allocator.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace RAJA
+{
+
+namespace numa
+{
+
+namespace
+{
+
+#if defined(__linux__)
+
+/* memory policy values of <linux/mempolicy.h>, which libnuma also defines */
+constexpr int RAJA_MPOL_BIND = 2;
+constexpr int RAJA_MPOL_INTERLEAVE = 3;
+constexpr int RAJA_MPOL_MF_MOVE = 1 << 1;
+
+/*
+ * Nodes listed in /sys/devices/system/node/online, such as "0-1" or "0,2-3"
+ */
+std::vector<int> readOnlineNodes()
+{
+  std::vector<int> nodes;
+  std::ifstream online("/sys/devices/system/node/online");
+  std::string list;
+  if (online >> list) {
+    size_t pos = 0;
+    while (pos < list.size()) {
+      size_t end = list.find(',', pos);
+      if (end == std::string::npos) end = list.size();
+      const std::string range = list.substr(pos, end - pos);
+      const size_t dash = range.find('-');
+      const int first = std::atoi(range.substr(0, dash).c_str());
+      const int last = (dash == std::string::npos)
+                           ? first
+                           : std::atoi(range.substr(dash + 1).c_str());
+      for (int n = first; n <= last; ++n) {
+        nodes.push_back(n);
+      }
+      pos = end + 1;
+    }
+  }
+  if (nodes.empty()) {
+    nodes.push_back(0);
+  }
+  return nodes;
+}
+
+const std::vector<int>& onlineNodes()
+{
+  static const std::vector<int> nodes = readOnlineNodes();
+  return nodes;
+}
+
+size_t pageSize()
+{
+  static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+}
+
+/*
+ * Largest online node
+ */
+int maxNode()
+{
+  int max_node = 0;
+  for (int n : onlineNodes()) {
+    max_node = n > max_node ? n : max_node;
+  }
+  return max_node;
+}
+
+/*
+ * Apply memory policy to the pages of [ptr, ptr + nbytes), which are not
+ * yet touched; node is checked by allocate
+ */
+void placePages(void* ptr, size_t nbytes, placement mode, int node)
+{
+  if (mode == placement::first_touch) return;
+
+  std::vector<int> nodes;
+  if (mode == placement::bind) {
+    nodes.push_back(node);
+  } else {
+    nodes = onlineNodes();
+  }
+
+  int max_node = 0;
+  for (int n : nodes) {
+    max_node = n > max_node ? n : max_node;
+  }
+  const size_t bits_per_word = 8 * sizeof(unsigned long);
+  std::vector<unsigned long> mask(max_node / bits_per_word + 1, 0);
+  for (int n : nodes) {
+    mask[n / bits_per_word] |= 1ul << (n % bits_per_word);
+  }
+
+  /* the kernel reads one bit less than maxnode */
+  const unsigned long maxnode = mask.size() * bits_per_word + 1;
+  const int policy =
+      (mode == placement::bind) ? RAJA_MPOL_BIND : RAJA_MPOL_INTERLEAVE;
+
+  /* on failure, pages are placed by first touch */
+  syscall(SYS_mbind, ptr, nbytes, policy, mask.data(), maxnode, 0);
+}
+
+/* sizes of the mappings returned by allocate, for deallocate */
+std::mutex mapping_mutex;
+std::map<void*, size_t> mapping_sizes;
+
+/*
+ * Touch the pages of [ptr, ptr + nbytes), each by the thread whose static
+ * partition of the nbytes / elem_size elements holds the page's first byte
+ */
+void touchPages(void* ptr, size_t nbytes, size_t elem_size, size_t page)
+{
+  char* const bytes = static_cast<char*>(ptr);
+  const size_t num_elems = nbytes / elem_size;
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel
+  {
+    const size_t num_threads = omp_get_num_threads();
+    const size_t thread = omp_get_thread_num();
+#else
+  {
+    const size_t num_threads = 1;
+    const size_t thread = 0;
+#endif
+    /* elements of this thread in a schedule(static) loop */
+    const size_t chunk = num_elems / num_threads;
+    const size_t extra = num_elems % num_threads;
+    const size_t first_elem =
+        thread * chunk + (thread < extra ? thread : extra);
+    const size_t last_elem = first_elem + chunk + (thread < extra ? 1 : 0);
+
+    const size_t lo = first_elem * elem_size;
+    const size_t hi = (thread + 1 == num_threads) ? nbytes
+                                                   : last_elem * elem_size;
+    for (size_t b = (lo + page - 1) / page * page; b < hi; b += page) {
+      bytes[b] = 0;
+    }
+  }
+}
+
+#endif
+
+}  // namespace
+
+int getNumNodes()
+{
+#if defined(__linux__)
+  return static_cast<int>(onlineNodes().size());
+#else
+  return 1;
+#endif
+}
+
+void* allocate(size_t nbytes, size_t elem_size, placement mode, int node)
+{
+  if (nbytes == 0) return nullptr;
+  if (elem_size == 0) elem_size = 1;
+
+#if defined(__linux__)
+  if (mode == placement::bind && (node < 0 || node > maxNode())) {
+    RAJA_ABORT_OR_THROW("RAJA::numa::allocate: bind node is not a node of "
+                        "this machine");
+  }
+
+  const size_t page = pageSize();
+  const size_t len = (nbytes + page - 1) / page * page;
+
+  void* ptr = mmap(nullptr,
+                   len,
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS,
+                   -1,
+                   0);
+  if (ptr == MAP_FAILED) return nullptr;
+
+  placePages(ptr, len, mode, node);
+  touchPages(ptr, len, elem_size, page);
+
+  std::lock_guard<std::mutex> lock(mapping_mutex);
+  mapping_sizes[ptr] = len;
+  return ptr;
+#else
+  (void)mode;
+  (void)node;
+  return std::calloc(nbytes, 1);
+#endif
+}
+
+void deallocate(void* ptr)
+{
+  if (ptr == nullptr) return;
+
+#if defined(__linux__)
+  size_t len = 0;
+  {
+    std::lock_guard<std::mutex> lock(mapping_mutex);
+    auto it = mapping_sizes.find(ptr);
+    if (it == mapping_sizes.end()) return;
+    len = it->second;
+    mapping_sizes.erase(it);
+  }
+  munmap(ptr, len);
+#else
+  std::free(ptr);
+#endif
+}
+
+long movePages(void* ptr, size_t nbytes, int node)
+{
+#if defined(__linux__)
+  const size_t page = pageSize();
+  char* const first =
+      reinterpret_cast<char*>(reinterpret_cast<uintptr_t>(ptr) / page * page);
+  char* const last = static_cast<char*>(ptr) + nbytes;
+
+  std::vector<void*> pages;
+  for (char* p = first; p < last; p += page) {
+    pages.push_back(p);
+  }
+  std::vector<int> nodes(pages.size(), node);
+  std::vector<int> status(pages.size(), -1);
+
+  if (syscall(SYS_move_pages,
+              0,
+              pages.size(),
+              pages.data(),
+              nodes.data(),
+              status.data(),
+              RAJA_MPOL_MF_MOVE) < 0) {
+    return -1;
+  }
+
+  long moved = 0;
+  for (int s : status) {
+    if (s == node) ++moved;
+  }
+  return moved;
+#else
+  (void)ptr;
+  (void)nbytes;
+  (void)node;
+  return -1;
+#endif
+}
+
+int getNode(const void* ptr)
+{
+#if defined(__linux__)
+  const size_t page = pageSize();
+  void* pages[1] = {
+      reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(ptr) / page * page)};
+  int status[1] = {-1};
+
+  /* with no target nodes, move_pages reports the node of each page */
+  if (syscall(SYS_move_pages, 0, 1, pages, nullptr, status, 0) < 0) {
+    return -1;
+  }
+  return status[0] >= 0 ? status[0] : -1;
+#else
+  (void)ptr;
+  return -1;
+#endif
+}
+
+}  // namespace numa
+
+}  // namespace RAJA
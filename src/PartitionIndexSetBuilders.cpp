@@ -0,0 +1,90 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for partition index set builder methods.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with one segment per part of a partitioned index
+ * array.
+ *
+ ******************************************************************************
+ */
+void buildIndexSetPartitioned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices,
+    const RAJA::Index_type* const part_offsets,
+    RAJA::Index_type num_parts)
+{
+  if (num_parts <= 0) return;
+
+  /* list segments of parts that are not ranges, nullptr for ranges */
+  std::vector<RAJA::ListSegment*> lists(num_parts, nullptr);
+
+  /******************************************************/
+  /* first, classify the parts and build list segments, */
+  /* which copy their indices, in parallel              */
+  /******************************************************/
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+  for (RAJA::Index_type p = 0; p < num_parts; ++p) {
+    const RAJA::Index_type* part = indices + part_offsets[p];
+    RAJA::Index_type len = part_offsets[p + 1] - part_offsets[p];
+
+    bool is_range = true;
+    for (RAJA::Index_type ii = 1; ii < len && is_range; ++ii) {
+      is_range = (part[ii] == part[ii - 1] + 1);
+    }
+
+    if (!is_range) {
+      lists[p] = new RAJA::ListSegment(part, len, work_res);
+    }
+  }
+
+  /*****************************************************/
+  /* now, append segments in order; list segment copies */
+  /* share the index data built above                   */
+  /*****************************************************/
+
+  for (RAJA::Index_type p = 0; p < num_parts; ++p) {
+    if (lists[p] != nullptr) {
+      iset.push_back(*lists[p]);
+      delete lists[p];
+    } else {
+      RAJA::Index_type len = part_offsets[p + 1] - part_offsets[p];
+      RAJA::Index_type begin = len > 0 ? indices[part_offsets[p]] : 0;
+      iset.push_back(RangeSegment(begin, begin + len));
+    }
+  }
+}
+
+}  // namespace RAJA
@@ -0,0 +1,334 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/TracePlugin.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <ostream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Small dense ids for the threads launching kernels, used as trace "tid"s
+std::atomic<int> next_thread_id{0};
+thread_local int thread_id = next_thread_id++;
+
+// Launch start times; a stack since launches may nest (e.g. forall in launch)
+thread_local std::vector<uint64_t> start_times;
+
+const char* platformName(RAJA::Platform p)
+{
+  switch (p) {
+    case RAJA::Platform::host:
+      return "host";
+    case RAJA::Platform::cuda:
+      return "cuda";
+    case RAJA::Platform::hip:
+      return "hip";
+    case RAJA::Platform::omp_target:
+      return "omp_target";
+    case RAJA::Platform::sycl:
+      return "sycl";
+    default:
+      return "undefined";
+  }
+}
+
+void writeString(std::ostream& os, const std::string& s)
+{
+  os << '"';
+  for (char c : s) {
+    switch (c) {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      case '\n':
+        os << "\\n";
+        break;
+      case '\t':
+        os << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8];
+          std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+          os << buf;
+        } else {
+          os << c;
+        }
+    }
+  }
+  os << '"';
+}
+
+void writeMicroseconds(std::ostream& os, uint64_t ns)
+{
+  char buf[32];
+  std::snprintf(buf,
+                sizeof(buf),
+                "%llu.%03llu",
+                static_cast<unsigned long long>(ns / 1000),
+                static_cast<unsigned long long>(ns % 1000));
+  os << buf;
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+size_t TraceHistogram::bucketIndex(uint64_t value)
+{
+  if (value < sub_bucket_count) {
+    return static_cast<size_t>(value);
+  }
+  int msb = 63;
+  while (!(value >> msb)) {
+    --msb;
+  }
+  const int shift = msb - sub_bucket_bits;
+  return static_cast<size_t>(shift + 1) * sub_bucket_count +
+         static_cast<size_t>((value >> shift) & (sub_bucket_count - 1));
+}
+
+uint64_t TraceHistogram::bucketLowerBound(size_t index)
+{
+  if (index < sub_bucket_count) {
+    return static_cast<uint64_t>(index);
+  }
+  const size_t shift = index / sub_bucket_count - 1;
+  const uint64_t sub = index % sub_bucket_count;
+  return (sub_bucket_count + sub) << shift;
+}
+
+void TraceHistogram::record(uint64_t value)
+{
+  ++counts[bucketIndex(value)];
+  ++total_count;
+  total_sum += value;
+  if (value < min_value) min_value = value;
+  if (value > max_value) max_value = value;
+}
+
+double TraceHistogram::mean() const
+{
+  return total_count ? static_cast<double>(total_sum) / total_count : 0.0;
+}
+
+uint64_t TraceHistogram::percentile(double fraction) const
+{
+  if (total_count == 0) {
+    return 0;
+  }
+  uint64_t target = static_cast<uint64_t>(fraction * total_count + 0.5);
+  if (target < 1) target = 1;
+  if (target > total_count) target = total_count;
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < bucket_count; ++i) {
+    seen += counts[i];
+    if (seen >= target) {
+      // report the highest value equivalent to this bucket
+      if (i + 1 == bucket_count) {
+        return max_value;
+      }
+      const uint64_t upper = bucketLowerBound(i + 1) - 1;
+      return upper < max_value ? upper : max_value;
+    }
+  }
+  return max_value;
+}
+
+size_t TracePlugin::PointerPairHash::operator()(
+    const std::pair<const char*, const char*>& p) const
+{
+  const size_t h = std::hash<const char*>{}(p.first);
+  return h ^ (std::hash<const char*>{}(p.second) + 0x9e3779b9 + (h << 6) +
+              (h >> 2));
+}
+
+TracePlugin::TracePlugin() : epoch(clock::now()), max_events(1000000)
+{
+  const char* file = ::getenv("RAJA_TRACE_FILE");
+  filename = file ? file : "raja-trace.json";
+
+  const char* limit = ::getenv("RAJA_TRACE_MAX_EVENTS");
+  if (limit) {
+    max_events = static_cast<size_t>(std::strtoull(limit, nullptr, 10));
+  }
+}
+
+TracePlugin::~TracePlugin()
+{
+  // Make sure a trace is written even if finalize_plugins() is never called
+  finalize();
+}
+
+uint64_t TracePlugin::now() const
+{
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                           epoch)
+          .count());
+}
+
+void TracePlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  start_times.push_back(now());
+}
+
+void TracePlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  const uint64_t end = now();
+  if (start_times.empty()) {
+    return;
+  }
+  const uint64_t start = start_times.back();
+  start_times.pop_back();
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  const size_t kernel = lookup(p);
+  KernelRecord& record = *kernels[kernel];
+  record.histogram.record(end - start);
+  record.iterations += p.iteration_size;
+
+  if (events.size() < max_events) {
+    events.push_back(
+        Event{kernel, start, end - start, p.iteration_size, thread_id});
+  }
+}
+
+// Called with the mutex held. Names are usually string literals or cached
+// type names, so look them up by address first and fall back to comparing
+// contents when an address is new or has been reused for a different name.
+size_t TracePlugin::lookup(const RAJA::util::PluginContext& p)
+{
+  const char* name = p.kernel_name ? p.kernel_name : "";
+  const char* policy = p.policy_name ? p.policy_name : "";
+  const auto key = std::make_pair(name, policy);
+
+  auto cached = pointer_cache.find(key);
+  if (cached != pointer_cache.end()) {
+    const KernelRecord& record = *kernels[cached->second];
+    if (record.name == name && record.policy == policy) {
+      return cached->second;
+    }
+  }
+
+  std::string full_key(name);
+  full_key.push_back('\0');
+  full_key.append(policy);
+
+  size_t kernel;
+  auto found = kernel_index.find(full_key);
+  if (found != kernel_index.end()) {
+    kernel = found->second;
+  } else {
+    kernel = kernels.size();
+    kernels.emplace_back(
+        std::unique_ptr<KernelRecord>(new KernelRecord(name, policy, p.platform)));
+    kernel_index.emplace(std::move(full_key), kernel);
+  }
+  pointer_cache[key] = kernel;
+  return kernel;
+}
+
+void TracePlugin::write(std::ostream& os) const
+{
+#ifndef _WIN32
+  const long pid = static_cast<long>(::getpid());
+#else
+  const long pid = 0;
+#endif
+
+  os << "{\n\"displayTimeUnit\": \"ns\",\n\"traceEvents\": [";
+  bool first = true;
+  for (const Event& e : events) {
+    const KernelRecord& k = *kernels[e.kernel];
+    os << (first ? "\n" : ",\n") << "{\"name\": ";
+    writeString(os, k.name);
+    os << ", \"cat\": \"" << platformName(k.platform)
+       << "\", \"ph\": \"X\", \"ts\": ";
+    writeMicroseconds(os, e.start);
+    os << ", \"dur\": ";
+    writeMicroseconds(os, e.duration);
+    os << ", \"pid\": " << pid << ", \"tid\": " << e.thread
+       << ", \"args\": {\"policy\": ";
+    writeString(os, k.policy);
+    os << ", \"iterations\": " << e.size << "}}";
+    first = false;
+  }
+  os << "\n],\n\"rajaKernelSummary\": [";
+
+  first = true;
+  for (const auto& kernel : kernels) {
+    const KernelRecord& k = *kernel;
+    const TraceHistogram& h = k.histogram;
+    os << (first ? "\n" : ",\n") << "{\"name\": ";
+    writeString(os, k.name);
+    os << ", \"policy\": ";
+    writeString(os, k.policy);
+    os << ", \"platform\": \"" << platformName(k.platform) << "\""
+       << ", \"launches\": " << h.count() << ", \"iterations\": "
+       << k.iterations << ", \"total_ns\": " << h.sum()
+       << ", \"min_ns\": " << h.min() << ", \"mean_ns\": " << h.mean()
+       << ", \"p50_ns\": " << h.percentile(0.5)
+       << ", \"p90_ns\": " << h.percentile(0.9)
+       << ", \"p99_ns\": " << h.percentile(0.99)
+       << ", \"max_ns\": " << h.max() << ", \"histogram\": [";
+    bool first_bucket = true;
+    for (size_t i = 0; i < TraceHistogram::bucket_count; ++i) {
+      if (h.bucketCount(i)) {
+        os << (first_bucket ? "" : ", ") << "["
+           << TraceHistogram::bucketLowerBound(i) << ", " << h.bucketCount(i)
+           << "]";
+        first_bucket = false;
+      }
+    }
+    os << "]}";
+    first = false;
+  }
+  os << "\n]\n}\n";
+}
+
+void TracePlugin::finalize()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (written || kernels.empty()) {
+    return;
+  }
+
+  std::ofstream out(filename);
+  if (!out) {
+    printf("[TracePlugin]: could not open trace file %s\n", filename.c_str());
+    return;
+  }
+  write(out);
+  written = true;
+}
+
+void linkTracePlugin() {}
+
+}  // end namespace util
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::TracePlugin> P(
+    "TracePlugin",
+    "Record kernel launch timings and write a Chrome trace.");
@@ -0,0 +1,232 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for foralls that replay the thread mapping
+/// recorded by a RAJA::affinity_schedule
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(ForallAffinity, OpenMPReplayRangeByValue)
+{
+  constexpr int N = 10007;
+
+  std::vector<int> owner(N, -1), count(N, 0);
+  int* powner = owner.data();
+  int* pcount = count.data();
+
+  RAJA::affinity_schedule sched;
+
+  RAJA::forall(RAJA::omp_parallel_for_affinity_exec(sched),
+               RAJA::RangeSegment(0, N),
+               [=](int i) {
+                 powner[i] = omp_get_thread_num();
+                 pcount[i] += 1;
+               });
+
+  // interior and shifted loops run each index on the thread that ran it in
+  // the first loop, and indices past its end on the last thread
+  std::vector<int> moved(N + 5, 0);
+  int* pmoved = moved.data();
+  for (int step = 0; step < 3; ++step) {
+    RAJA::forall(RAJA::omp_parallel_for_affinity_exec(sched),
+                 RAJA::RangeSegment(1, N - 1),
+                 [=](int i) {
+                   if (powner[i] != omp_get_thread_num()) {
+                     pmoved[i] += 1;
+                   }
+                   pcount[i] += 1;
+                 });
+  }
+
+  RAJA::forall(RAJA::omp_parallel_for_affinity_exec(sched),
+               RAJA::RangeSegment(N / 2, N + 5),
+               [=](int i) {
+                 if (i < N) {
+                   if (powner[i] != omp_get_thread_num()) {
+                     pmoved[i] += 1;
+                   }
+                   pcount[i] += 1;
+                 } else if (omp_get_thread_num() + 1 != omp_get_num_threads()) {
+                   pmoved[i] += 1;
+                 }
+               });
+
+  for (int i = 0; i < N + 5; ++i) {
+    ASSERT_EQ(0, moved[i]);
+  }
+  for (int i = 0; i < N; ++i) {
+    int expect = 1 + ((i > 0 && i < N - 1) ? 3 : 0) + (i >= N / 2 ? 1 : 0);
+    ASSERT_EQ(expect, count[i]);
+  }
+}
+
+TEST(ForallAffinity, OpenMPReplayListByPosition)
+{
+  constexpr int N = 4099;
+
+  std::vector<int> idx(N);
+  for (int i = 0; i < N; ++i) {
+    idx[i] = (7 * i) % N;
+  }
+  RAJA::TypedListSegment<int> list(&idx[0], N, camp::resources::Host());
+  RAJA::TypedListSegment<int> half(&idx[0], N / 2, camp::resources::Host());
+
+  std::vector<int> owner(N, -1), count(N, 0);
+  int* powner = owner.data();
+  int* pcount = count.data();
+
+  RAJA::affinity_schedule sched;
+  RAJA::omp_parallel_for_affinity_exec pol(sched);
+
+  RAJA::forall(pol, list, [=](int i) {
+    powner[i] = omp_get_thread_num();
+    pcount[i] += 1;
+  });
+
+  std::vector<int> moved(N, 0);
+  int* pmoved = moved.data();
+  RAJA::forall(pol, list, [=](int i) {
+    if (powner[i] != omp_get_thread_num()) {
+      pmoved[i] += 1;
+    }
+    pcount[i] += 1;
+  });
+
+  // a list of another length records new blocks
+  RAJA::forall(pol, half, [=](int i) { pcount[i] += 1; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(0, moved[i]);
+  }
+  for (int k = 0; k < N; ++k) {
+    ASSERT_EQ(k < N / 2 ? 3 : 2, count[idx[k]]);
+  }
+}
+
+TEST(ForallAffinity, OpenMPForInRegion)
+{
+  constexpr int N = 10007;
+  constexpr int num_steps = 4;
+
+  std::vector<int> a(N, 0), b(N, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  RAJA::affinity_schedule sched;
+  RAJA::omp_for_affinity_exec pol(sched);
+
+  RAJA::region<RAJA::omp_parallel_region>([=]() {
+    for (int step = 0; step < num_steps; ++step) {
+      RAJA::forall(pol, RAJA::RangeSegment(0, N), [=](int i) {
+        pa[i] = i + step;
+      });
+      RAJA::forall(pol, RAJA::RangeSegment(1, N - 1), [=](int i) {
+        pb[i] += pa[i - 1] + pa[i + 1];
+      });
+    }
+  });
+
+  for (int i = 1; i < N - 1; ++i) {
+    int expect = 0;
+    for (int step = 0; step < num_steps; ++step) {
+      expect += 2 * (i + step);
+    }
+    ASSERT_EQ(expect, b[i]);
+  }
+}
+
+TEST(ForallAffinity, OpenMPTeamSizeChange)
+{
+  constexpr int N = 1001;
+
+  std::vector<int> count(N, 0);
+  int* pcount = count.data();
+
+  const int max_threads = omp_get_max_threads();
+
+  // a team of 2 records new blocks for the whole team, and the next team of
+  // 4 records again instead of replaying blocks of both recordings
+  RAJA::affinity_schedule sched(4);
+  const int team_sizes[] = {4, 2, 4, 3, 4};
+  const int firsts[] = {0, N / 3, 0, 0, 5};
+  const int lasts[] = {N, N, N, N, N - 5};
+  for (int l = 0; l < 5; ++l) {
+    omp_set_num_threads(team_sizes[l]);
+    RAJA::forall(RAJA::omp_parallel_for_affinity_exec(sched),
+                 RAJA::RangeSegment(firsts[l], lasts[l]),
+                 [=](int i) { pcount[i] += 1; });
+  }
+  omp_set_num_threads(max_threads);
+
+  for (int i = 0; i < N; ++i) {
+    int expect = 0;
+    for (int l = 0; l < 5; ++l) {
+      expect += (i >= firsts[l] && i < lasts[l]) ? 1 : 0;
+    }
+    ASSERT_EQ(expect, count[i]);
+  }
+}
+
+TEST(ForallAffinity, OpenMPReset)
+{
+  constexpr int N = 1000;
+
+  std::vector<int> count(N, 0);
+  int* pcount = count.data();
+
+  RAJA::affinity_schedule sched;
+
+  RAJA::forall(RAJA::omp_parallel_for_affinity_exec(sched),
+               RAJA::RangeSegment(500, N),
+               [=](int i) { pcount[i] += 1; });
+
+  sched.reset();
+
+  RAJA::forall(RAJA::omp_parallel_for_affinity_exec(sched),
+               RAJA::RangeSegment(0, N),
+               [=](int i) { pcount[i] += 1; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(i < 500 ? 1 : 2, count[i]);
+  }
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+
+TEST(ForallAffinity, TBBForAffinity)
+{
+  constexpr int N = 10007;
+  constexpr int num_steps = 4;
+
+  std::vector<int> count(N, 0);
+  int* pcount = count.data();
+
+  RAJA::affinity_schedule sched;
+
+  for (int step = 0; step < num_steps; ++step) {
+    RAJA::forall(RAJA::tbb_for_affinity(sched, 64),
+                 RAJA::RangeSegment(0, N),
+                 [=](int i) { pcount[i] += 1; });
+  }
+
+  RAJA::forall<RAJA::tbb_for_affinity>(RAJA::RangeSegment(0, N),
+                                       [=](int i) { pcount[i] += 1; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(num_steps + 1, count[i]);
+  }
+}
+
+#endif
@@ -0,0 +1,164 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA constructs reusing the team of an
+/// omp_persistent_region
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ForallPersistentRegion, ParallelForall)
+{
+  constexpr int N = 2557;
+
+  std::vector<int> count(N, 0);
+  int* pcount = count.data();
+
+  // each forall runs once over the team, not once per thread
+  RAJA::region<RAJA::omp_persistent_region>([=]() {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) { pcount[i] += 1; });
+
+    RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+        RAJA::RangeSegment(0, N), [=](int i) { pcount[i] += 2; });
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(3, count[i]);
+  }
+}
+
+TEST(ForallPersistentRegion, Reducers)
+{
+  constexpr int N = 4099;
+  constexpr int num_steps = 4;
+
+  std::vector<double> x(N, 0.0);
+  double* px = x.data();
+
+  RAJA::ReduceSum<RAJA::omp_reduce, double> sum(0.0);
+  RAJA::ReduceMax<RAJA::omp_reduce, double> max(0.0);
+
+  std::vector<double> step_max(num_steps * omp_get_max_threads(), -1.0);
+  double* pstep_max = step_max.data();
+
+  // get() inside the region combines over the team, so every thread sees
+  // the same maximum after each step
+  RAJA::region<RAJA::omp_persistent_region>([=]() {
+    for (int step = 0; step < num_steps; ++step) {
+      RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                                [=](int i) {
+        px[i] += 1.0;
+        sum += 1.0;
+        max.max(px[i] * (i + 1));
+      });
+      pstep_max[step * omp_get_max_threads() + omp_get_thread_num()] =
+          max.get();
+    }
+  });
+
+  for (int step = 0; step < num_steps; ++step) {
+    for (int t = 0; t < omp_get_max_threads(); ++t) {
+      const double m = step_max[step * omp_get_max_threads() + t];
+      if (m >= 0.0) {
+        ASSERT_EQ(double(step + 1) * N, m);
+      }
+    }
+  }
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(double(num_steps), x[i]);
+  }
+  ASSERT_EQ(double(num_steps) * N, sum.get());
+  ASSERT_EQ(double(num_steps) * N, max.get());
+}
+
+TEST(ForallPersistentRegion, ScanAndSort)
+{
+  constexpr int N = 3001;
+
+  std::vector<int> in(N), out(N), keys(N);
+  for (int i = 0; i < N; ++i) {
+    in[i] = i % 7;
+    keys[i] = (i * 37) % N;
+  }
+  int* pin = in.data();
+  int* pout = out.data();
+  int* pkeys = keys.data();
+
+  RAJA::region<RAJA::omp_persistent_region>([=]() {
+    RAJA::exclusive_scan<RAJA::omp_parallel_for_exec>(
+        RAJA::make_span(pin, N), RAJA::make_span(pout, N));
+    RAJA::inclusive_scan_inplace<RAJA::omp_parallel_for_exec>(
+        RAJA::make_span(pin, N));
+    RAJA::sort<RAJA::omp_parallel_for_exec>(RAJA::make_span(pkeys, N));
+  });
+
+  int acc = 0;
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(acc, out[i]);
+    acc += i % 7;
+    ASSERT_EQ(acc, in[i]);
+    ASSERT_EQ(i, keys[i]);
+  }
+}
+
+TEST(ForallPersistentRegion, NestedInLoopBody)
+{
+  constexpr int N = 64;
+  constexpr int M = 16;
+
+  std::vector<int> count(N * M, 0);
+  int* pcount = count.data();
+
+  // a forall in a loop body opens its own region instead of reusing the team
+  RAJA::region<RAJA::omp_persistent_region>([=]() {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) {
+      RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, M), [=](int j) { pcount[i * M + j] += 1; });
+    });
+  });
+
+  for (int i = 0; i < N * M; ++i) {
+    ASSERT_EQ(1, count[i]);
+  }
+}
+
+TEST(ForallPersistentRegion, ForallInLaunchLoop)
+{
+  constexpr int N = 64;
+  constexpr int M = 16;
+
+  using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>;
+  using loop_policy = RAJA::expt::LoopPolicy<RAJA::omp_for_exec>;
+
+  std::vector<int> count(N * M, 0);
+  int* pcount = count.data();
+
+  // the launch reuses the team, and a forall in the body of one of its
+  // loops opens its own region instead of nesting a worksharing loop
+  RAJA::region<RAJA::omp_persistent_region>([=]() {
+    RAJA::expt::launch<launch_policy>(
+        RAJA::expt::HOST,
+        RAJA::expt::Grid(),
+        [=](RAJA::expt::LaunchContext ctx) {
+          RAJA::expt::loop<loop_policy>(ctx, RAJA::RangeSegment(0, N),
+                                        [&](int i) {
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+                RAJA::RangeSegment(0, M),
+                [=](int j) { pcount[i * M + j] += 1; });
+          });
+        });
+  });
+
+  for (int i = 0; i < N * M; ++i) {
+    ASSERT_EQ(1, count[i]);
+  }
+}
@@ -0,0 +1,126 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for omp_loop_token dependencies between
+/// nowait loops in an OpenMP region
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+using NowaitPolicy = RAJA::omp_for_nowait_static_exec<>;
+
+TEST(ForallRegionToken, WaitAll)
+{
+  constexpr int N = 10007;
+  constexpr int num_steps = 5;
+
+  std::vector<int> a(N, 0), b(N, 0), c(N, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+  int* pc = c.data();
+
+  RAJA::omp_loop_token a_done;
+
+  // c reads entries of a written by other threads, so it waits on a_done;
+  // b is independent and runs between the signal and the wait
+  RAJA::region<RAJA::omp_parallel_region>([=]() {
+    for (int step = 0; step < num_steps; ++step) {
+      RAJA::forall<NowaitPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+        pa[i] = i + step;
+      });
+      a_done.signal();
+
+      RAJA::forall<NowaitPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+        pb[i] += 1;
+      });
+
+      a_done.wait();
+      RAJA::forall<NowaitPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+        pc[i] += pa[N - 1 - i];
+      });
+
+      RAJA::synchronize<RAJA::omp_synchronize>();
+    }
+  });
+
+  for (int i = 0; i < N; ++i) {
+    int expect = 0;
+    for (int step = 0; step < num_steps; ++step) {
+      expect += N - 1 - i + step;
+    }
+    ASSERT_EQ(num_steps, b[i]);
+    ASSERT_EQ(expect, c[i]);
+  }
+}
+
+TEST(ForallRegionToken, WaitNeighbors)
+{
+  constexpr int N = 4099;
+  constexpr int num_steps = 6;
+
+  std::vector<int> u(N, 0), v(N, 0);
+  int* pu = u.data();
+  int* pv = v.data();
+
+  RAJA::omp_loop_token u_done;
+  RAJA::omp_loop_token v_done;
+
+  // with the same static schedule for both loops, a three point stencil
+  // only reads points owned by the caller and its neighboring threads
+  RAJA::region<RAJA::omp_parallel_region>([=]() {
+    for (int step = 0; step < num_steps; ++step) {
+      RAJA::forall<NowaitPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+        pu[i] = i * (step + 1);
+      });
+      u_done.signal();
+
+      u_done.wait_neighbors();
+      RAJA::forall<NowaitPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+        pv[i] = (i > 0 ? pu[i - 1] : 0) + (i < N - 1 ? pu[i + 1] : 0);
+      });
+      v_done.signal();
+
+      // the next step overwrites u, which neighbors may still be reading
+      v_done.wait_neighbors();
+    }
+  });
+
+  for (int i = 1; i < N - 1; ++i) {
+    ASSERT_EQ(2 * i * num_steps, v[i]);
+  }
+}
+
+TEST(ForallRegionToken, SuccessiveRegions)
+{
+  constexpr int N = 1031;
+
+  std::vector<int> a(N, 0), b(N, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  RAJA::omp_loop_token a_done;
+
+  for (int rep = 1; rep <= 3; ++rep) {
+    RAJA::region<RAJA::omp_parallel_region>([=]() {
+      RAJA::forall<NowaitPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+        pa[i] = rep * i;
+      });
+      a_done.signal();
+      a_done.wait();
+      RAJA::forall<NowaitPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+        pb[i] = pa[N - 1 - i];
+      });
+    });
+
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(rep * (N - 1 - i), b[i]);
+    }
+  }
+}
@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BITMASKSEGMENT_HPP__
+#define __TEST_FORALL_BITMASKSEGMENT_HPP__
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallBitmaskSegmentTestImpl(INDEX_TYPE N)
+{
+  // bitmask segments store plain integers
+  using STORAGE_TYPE = RAJA::strip_index_type_t<INDEX_TYPE>;
+
+  const STORAGE_TYPE n = RAJA::stripIndexType(N);
+
+  // The segment covers [5, n) with random bits set, including bits past n
+  // in the last word, which are not part of the segment
+  const STORAGE_TYPE first = n < 5 ? n : 5;
+  std::vector<uint64_t> bits((n - first + 63) / 64 + 1, 0);
+
+  srand ( time(NULL) );
+
+  for (size_t w = 0; w < bits.size(); ++w) {
+    for (int k = 0; k < 64; ++k) {
+      if ( rand() % 3 == 0 ) {
+        bits[w] |= uint64_t(1) << k;
+      }
+    }
+  }
+
+  RAJA::TypedBitmaskSegment<STORAGE_TYPE> seg(&bits[0], first, n);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  STORAGE_TYPE* working_array;
+  STORAGE_TYPE* check_array;
+  STORAGE_TYPE* test_array;
+
+  size_t data_len = n;
+  if ( data_len == 0 ) {
+    data_len = 1;
+  }
+
+  allocateForallTestData<STORAGE_TYPE>(data_len,
+                                       working_res,
+                                       &working_array,
+                                       &check_array,
+                                       &test_array);
+
+  memset(static_cast<void*>(test_array), 0, sizeof(STORAGE_TYPE) * data_len);
+
+  working_res.memcpy(working_array, test_array, sizeof(STORAGE_TYPE) * data_len);
+
+  for (STORAGE_TYPE i = first; i < n; ++i) {
+    const size_t bit = i - first;
+    if ( (bits[bit / 64] >> (bit % 64)) & 1 ) {
+      test_array[i] = i + 1;
+    }
+  }
+
+  // each index adds to its own entry, so indices visited twice show up
+  RAJA::forall<EXEC_POLICY>(seg, [=] RAJA_HOST_DEVICE(STORAGE_TYPE idx) {
+    working_array[idx] += idx + 1;
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(STORAGE_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<STORAGE_TYPE>(working_res,
+                                         working_array,
+                                         check_array,
+                                         test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallBitmaskSegmentTest);
+template <typename T>
+class ForallBitmaskSegmentTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallBitmaskSegmentTest, BitmaskSegmentForall)
+{
+  using INDEX_TYPE       = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // test zero-length segment
+  ForallBitmaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(INDEX_TYPE(0));
+
+  ForallBitmaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(INDEX_TYPE(13));
+
+  ForallBitmaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(INDEX_TYPE(2047));
+
+  ForallBitmaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(INDEX_TYPE(32000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallBitmaskSegmentTest,
+                            BitmaskSegmentForall);
+
+#endif  // __TEST_FORALL_BITMASKSEGMENT_HPP__
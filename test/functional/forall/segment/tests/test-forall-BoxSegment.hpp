@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BOXSEGMENT_HPP__
+#define __TEST_FORALL_BOXSEGMENT_HPP__
+
+#include <cstring>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY,
+          typename ORDER>
+void ForallBoxSegmentTestImpl(INDEX_TYPE NX, INDEX_TYPE NY, INDEX_TYPE NZ)
+{
+  // box segments store plain integers
+  using STORAGE_TYPE = RAJA::strip_index_type_t<INDEX_TYPE>;
+
+  const STORAGE_TYPE nx = RAJA::stripIndexType(NX);
+  const STORAGE_TYPE ny = RAJA::stripIndexType(NY);
+  const STORAGE_TYPE nz = RAJA::stripIndexType(NZ);
+
+  // The box covers [1, nx) x [0, ny) x [2, nz) of an nx x ny x nz array,
+  // which is empty when nx < 2 or nz < 3
+  RAJA::TypedBoxSegment<STORAGE_TYPE, 3, ORDER> box(
+      {{STORAGE_TYPE(1), STORAGE_TYPE(0), STORAGE_TYPE(2)}}, {{nx, ny, nz}});
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  STORAGE_TYPE* working_array;
+  STORAGE_TYPE* check_array;
+  STORAGE_TYPE* test_array;
+
+  size_t data_len = size_t(nx) * size_t(ny) * size_t(nz);
+  if ( data_len == 0 ) {
+    data_len = 1;
+  }
+
+  allocateForallTestData<STORAGE_TYPE>(data_len,
+                                       working_res,
+                                       &working_array,
+                                       &check_array,
+                                       &test_array);
+
+  memset(static_cast<void*>(test_array), 0, sizeof(STORAGE_TYPE) * data_len);
+
+  working_res.memcpy(working_array, test_array, sizeof(STORAGE_TYPE) * data_len);
+
+  for (STORAGE_TYPE i = 1; i < nx; ++i) {
+    for (STORAGE_TYPE j = 0; j < ny; ++j) {
+      for (STORAGE_TYPE k = 2; k < nz; ++k) {
+        test_array[(i * ny + j) * nz + k] = 1;
+      }
+    }
+  }
+
+  // each point adds one to its own entry, so points visited twice show up
+  RAJA::forall<EXEC_POLICY>(box,
+      [=] RAJA_HOST_DEVICE(RAJA::BoxIndex<STORAGE_TYPE, 3> p) {
+    working_array[(p[0] * ny + p[1]) * nz + p[2]] += 1;
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(STORAGE_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<STORAGE_TYPE>(working_res,
+                                         working_array,
+                                         check_array,
+                                         test_array);
+}
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallBoxSegmentOrdersTestImpl(INDEX_TYPE NX, INDEX_TYPE NY, INDEX_TYPE NZ)
+{
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY,
+                           RAJA::box_order::row_major>(NX, NY, NZ);
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY,
+                           RAJA::box_order::tiled<4>>(NX, NY, NZ);
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY,
+                           RAJA::box_order::morton>(NX, NY, NZ);
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY,
+                           RAJA::box_order::hilbert>(NX, NY, NZ);
+}
+
+
+TYPED_TEST_SUITE_P(ForallBoxSegmentTest);
+template <typename T>
+class ForallBoxSegmentTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallBoxSegmentTest, BoxSegmentForall)
+{
+  using INDEX_TYPE       = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // test empty box
+  ForallBoxSegmentOrdersTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(
+      INDEX_TYPE(1), INDEX_TYPE(4), INDEX_TYPE(5));
+
+  ForallBoxSegmentOrdersTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(
+      INDEX_TYPE(6), INDEX_TYPE(7), INDEX_TYPE(5));
+
+  ForallBoxSegmentOrdersTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(
+      INDEX_TYPE(17), INDEX_TYPE(16), INDEX_TYPE(19));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallBoxSegmentTest,
+                            BoxSegmentForall);
+
+#endif  // __TEST_FORALL_BOXSEGMENT_HPP__
@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_COMPRESSEDLISTSEGMENT_HPP__
+#define __TEST_FORALL_COMPRESSEDLISTSEGMENT_HPP__
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallCompressedListSegmentTestImpl(INDEX_TYPE N)
+{
+  // compressed list segments store plain integers
+  using STORAGE_TYPE = RAJA::strip_index_type_t<INDEX_TYPE>;
+
+  const STORAGE_TYPE n = RAJA::stripIndexType(N);
+
+  // Create indices in idx_array used to create the segment: a random subset
+  // of [0, N) in increasing order, with every 50th index jumping back so
+  // blocks are not sorted
+  std::vector<STORAGE_TYPE> idx_array;
+
+  srand ( time(NULL) );
+
+  for (STORAGE_TYPE i = 0; i < n; ++i) {
+    STORAGE_TYPE randval = STORAGE_TYPE(rand() % n);
+    if ( i < randval ) {
+      idx_array.push_back(idx_array.size() % 50 == 49 ? i / 3 : i);
+    }
+  }
+
+  size_t idxlen = idx_array.size();
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  RAJA::TypedCompressedListSegment<STORAGE_TYPE> cseg(idx_array, working_res);
+
+  STORAGE_TYPE* working_array;
+  STORAGE_TYPE* check_array;
+  STORAGE_TYPE* test_array;
+
+  size_t data_len = n;
+  if ( data_len == 0 ) {
+    data_len = 1;
+  }
+
+  allocateForallTestData<STORAGE_TYPE>(data_len,
+                                       working_res,
+                                       &working_array,
+                                       &check_array,
+                                       &test_array);
+
+  memset(static_cast<void*>(test_array), 0, sizeof(STORAGE_TYPE) * data_len);
+
+  working_res.memcpy(working_array, test_array, sizeof(STORAGE_TYPE) * data_len);
+
+  for (size_t i = 0; i < idxlen; ++i) {
+    test_array[ idx_array[i] ] = idx_array[i] + 1;
+  }
+
+  RAJA::forall<EXEC_POLICY>(cseg, [=] RAJA_HOST_DEVICE(STORAGE_TYPE idx) {
+    working_array[idx] = idx + 1;
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(STORAGE_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<STORAGE_TYPE>(working_res,
+                                         working_array,
+                                         check_array,
+                                         test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallCompressedListSegmentTest);
+template <typename T>
+class ForallCompressedListSegmentTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallCompressedListSegmentTest, CompressedListSegmentForall)
+{
+  using INDEX_TYPE       = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // test zero-length segment
+  ForallCompressedListSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(INDEX_TYPE(0));
+
+  ForallCompressedListSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(INDEX_TYPE(13));
+
+  ForallCompressedListSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(INDEX_TYPE(2047));
+
+  ForallCompressedListSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(INDEX_TYPE(32000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallCompressedListSegmentTest,
+                            CompressedListSegmentForall);
+
+#endif  // __TEST_FORALL_COMPRESSEDLISTSEGMENT_HPP__
@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for partitioned IndexSet builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp" 
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+TEST(IndexSetBuild, Partitioned)
+{
+  using RSType = RAJA::RangeSegment;
+  using LSType = RAJA::ListSegment;
+
+  //
+  // Create index vector with four parts:
+  // {0, 1, ..., 7},  {10, 12, 11},  {},  {20, 21}
+  //
+  std::vector<RAJA::Index_type> indices{0, 1, 2, 3, 4, 5, 6, 7,
+                                        10, 12, 11,
+                                        20, 21};
+  std::vector<RAJA::Index_type> part_offsets{0, 8, 11, 11, 13};
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+
+  RAJA::buildIndexSetPartitioned(iset,
+                                 res,
+                                 &indices[0],
+                                 &part_offsets[0],
+                                 4);
+
+  ASSERT_EQ(iset.getLength(), indices.size());
+
+  ASSERT_EQ(iset.size(), 4);
+
+  const RSType& s0 = iset.getSegment<const RSType>(0);
+  ASSERT_EQ(s0.size(), 8);
+  ASSERT_EQ(*s0.begin(), 0);
+
+  const LSType& s1 = iset.getSegment<const LSType>(1);
+  ASSERT_TRUE(s1.indicesEqual(&indices[8], 3));
+
+  ASSERT_EQ(iset.getSegmentLength(2), 0);
+
+  const RSType& s3 = iset.getSegment<const RSType>(3);
+  ASSERT_EQ(s3.size(), 2);
+  ASSERT_EQ(*s3.begin(), 20);
+
+  for (RAJA::Index_type p = 0; p < 4; ++p) {
+    ASSERT_EQ(iset.getStartingIcount(p), part_offsets[p]);
+    ASSERT_EQ(iset.getSegmentLength(p), part_offsets[p + 1] - part_offsets[p]);
+  }
+}
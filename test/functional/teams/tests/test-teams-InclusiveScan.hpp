@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_INCLUSIVE_SCAN_HPP__
+#define __TEST_TEAMS_INCLUSIVE_SCAN_HPP__
+
+#include "test-teams-collective-utils.hpp"
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsInclusiveScanTestImpl()
+{
+
+  constexpr int num_teams = teams_collective_num_teams;
+  const int N = teamsCollectiveOffset(num_teams);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  for (int i = 0; i < N; ++i) {
+    test_array[i] = teamsCollectiveValue(i);
+  }
+
+  forEachTeamsCollectiveSize([&](int team_size) {
+
+    working_res.memcpy(working_array, test_array, sizeof(int) * N);
+    int* data = working_array;
+
+    RAJA::expt::launch<LAUNCH_POLICY>(RAJA::expt::HOST,
+      RAJA::expt::Grid(RAJA::expt::Teams(num_teams),
+                       RAJA::expt::Threads(team_size)),
+          [=](RAJA::expt::LaunchContext ctx) {
+
+            RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, num_teams), [&](int r) {
+
+                  RAJA::RangeSegment seg(teamsCollectiveOffset(r),
+                                         teamsCollectiveOffset(r + 1));
+
+                  RAJA::expt::loop_inclusive_scan<THREAD_POLICY>(ctx, seg, data,
+                      RAJA::operators::plus<int>{});
+
+                });  // loop r
+          });  // outer lambda
+
+    working_res.memcpy(check_array, working_array, sizeof(int) * N);
+
+    for (int r = 0; r < num_teams; ++r) {
+      int sum = 0;
+      for (int i = teamsCollectiveOffset(r); i < teamsCollectiveOffset(r + 1); ++i) {
+        sum += test_array[i];
+        ASSERT_EQ(sum, check_array[i]);
+      }
+    }
+  });
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsInclusiveScanTest);
+template <typename T>
+class TeamsInclusiveScanTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsInclusiveScanTest, InclusiveScanTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsInclusiveScanTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsInclusiveScanTest,
+                            InclusiveScanTeams);
+
+#endif  // __TEST_TEAMS_INCLUSIVE_SCAN_HPP__
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_REDUCE_HPP__
+#define __TEST_TEAMS_REDUCE_HPP__
+
+#include <algorithm>
+#include <vector>
+
+#include "test-teams-collective-utils.hpp"
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsReduceTestImpl()
+{
+
+  constexpr int num_teams = teams_collective_num_teams;
+  const int N = teamsCollectiveOffset(num_teams);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  for (int i = 0; i < N; ++i) {
+    test_array[i] = teamsCollectiveValue(i);
+  }
+  working_res.memcpy(working_array, test_array, sizeof(int) * N);
+
+  forEachTeamsCollectiveSize([&](int team_size) {
+
+    std::vector<int> sums(num_teams, 0), maxs(num_teams, 0);
+    int* psums = sums.data();
+    int* pmaxs = maxs.data();
+    int* data = working_array;
+
+    RAJA::expt::launch<LAUNCH_POLICY>(RAJA::expt::HOST,
+      RAJA::expt::Grid(RAJA::expt::Teams(num_teams),
+                       RAJA::expt::Threads(team_size)),
+          [=](RAJA::expt::LaunchContext ctx) {
+
+            RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, num_teams), [&](int r) {
+
+                  RAJA::RangeSegment seg(teamsCollectiveOffset(r),
+                                         teamsCollectiveOffset(r + 1));
+
+                  // every thread of the team receives the combined value
+                  int sum = RAJA::expt::loop_reduce<THREAD_POLICY>(ctx, seg, r,
+                      RAJA::operators::plus<int>{}, [&](int i) { return data[i]; });
+
+                  int max = RAJA::expt::loop_reduce<THREAD_POLICY>(ctx, seg, -100,
+                      RAJA::operators::maximum<int>{}, [&](int i) { return data[i]; });
+
+                  RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, 1), [&](int) {
+                      psums[r] = sum;
+                      pmaxs[r] = max;
+                  });
+
+                });  // loop r
+          });  // outer lambda
+
+    for (int r = 0; r < num_teams; ++r) {
+      int sum = r;
+      int max = -100;
+      for (int i = teamsCollectiveOffset(r); i < teamsCollectiveOffset(r + 1); ++i) {
+        sum += test_array[i];
+        max = std::max(max, test_array[i]);
+      }
+      ASSERT_EQ(sum, sums[r]);
+      ASSERT_EQ(max, maxs[r]);
+    }
+  });
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsReduceTest);
+template <typename T>
+class TeamsReduceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsReduceTest, ReduceTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsReduceTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsReduceTest,
+                            ReduceTeams);
+
+#endif  // __TEST_TEAMS_REDUCE_HPP__
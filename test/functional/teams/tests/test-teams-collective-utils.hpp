@@ -0,0 +1,46 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Data layout shared by the team reduction and scan tests: team r works on
+// [teamsCollectiveOffset(r), teamsCollectiveOffset(r + 1)), so team lengths
+// are 0, 37, 74, ..., none of them a power of two.
+//
+
+#ifndef __TEST_TEAMS_COLLECTIVE_UTILS_HPP__
+#define __TEST_TEAMS_COLLECTIVE_UTILS_HPP__
+
+constexpr int teams_collective_num_teams = 9;
+
+inline int teamsCollectiveOffset(int r) { return 37 * r * (r - 1) / 2; }
+
+inline int teamsCollectiveValue(int i) { return (i * 7) % 11 - 5; }
+
+//
+// Run func(team_size) for odd team sizes; OpenMP launches run their teams
+// with that many threads.
+//
+template <typename FUNC>
+void forEachTeamsCollectiveSize(FUNC&& func)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  const int max_threads = omp_get_max_threads();
+#endif
+
+  for (int team_size : {1, 3, 7}) {
+#if defined(RAJA_ENABLE_OPENMP)
+    omp_set_num_threads(team_size);
+#endif
+    func(team_size);
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp_set_num_threads(max_threads);
+#endif
+}
+
+#endif  // __TEST_TEAMS_COLLECTIVE_UTILS_HPP__
@@ -31,11 +31,13 @@ using OpenMPForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
 
 using OpenMPForallIndexSetReduceExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
 #endif
 
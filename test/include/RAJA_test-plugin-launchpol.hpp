@@ -0,0 +1,42 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Launch and loop policy lists used throughout plugin tests
+//
+
+#ifndef __RAJA_test_plugin_launchpol_HPP__
+#define __RAJA_test_plugin_launchpol_HPP__
+
+#include "RAJA/RAJA.hpp"
+
+#include "camp/list.hpp"
+
+// Sequential execution policy types
+using SequentialPluginLaunchExecPols = camp::list<
+      camp::list<
+        RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>,
+        RAJA::expt::LoopPolicy<RAJA::loop_exec>>
+    >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPPluginLaunchExecPols = camp::list<
+      camp::list<
+        RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>,
+        RAJA::expt::LoopPolicy<RAJA::omp_for_exec>>
+    >;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBPluginLaunchExecPols = camp::list<
+      camp::list<
+        RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+        RAJA::expt::LoopPolicy<RAJA::tbb_for_dynamic>>
+    >;
+#endif
+
+#endif  // __RAJA_test_plugin_launchpol_HPP__
@@ -79,6 +79,67 @@ using OpenMP_launch_policies = camp::list<
 
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_TBB)
+using TBB_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_dynamic>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_dynamic>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_static<4>>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
+#endif  // RAJA_ENABLE_TBB
+
+//
+// Team reductions and scans are provided by host loop policies only; the
+// lists run them both as team loops executed by one thread and as thread
+// loops shared by all threads of a team
+//
+using Sequential_collective_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::seq_exec>,
+         RAJA::expt::LoopPolicy<RAJA::simd_exec>>>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMP_collective_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::omp_for_exec>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>,
+         RAJA::expt::LoopPolicy<RAJA::omp_for_exec>>>;
+
+//
+// Nested launches execute each team with a group of threads, here of an odd
+// size and of the default size
+//
+using OpenMP_nested_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_nested_launch_t<3>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_distribute_exec>,
+         RAJA::expt::LoopPolicy<RAJA::omp_for_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_nested_launch_t<>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_distribute_exec>,
+         RAJA::expt::LoopPolicy<RAJA::omp_for_exec>>>;
+#endif  // RAJA_ENABLE_OPENMP
+
+#if defined(RAJA_ENABLE_TBB)
+using TBB_collective_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_dynamic>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
+#endif  // RAJA_ENABLE_TBB
+
 #if defined(RAJA_ENABLE_CUDA)
 using Cuda_launch_policies = camp::list<
          seq_cuda_policies
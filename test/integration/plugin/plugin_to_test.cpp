@@ -54,6 +54,9 @@ class CounterPlugin :
     ASSERT_EQ(data.launch_platform_active, RAJA::Platform::undefined);
     data.launch_counter_pre++;
     data.launch_platform_active = p.platform;
+    data.launch_iteration_size = p.iteration_size;
+    data.launch_kernel_name = p.kernel_name;
+    data.launch_policy_name = p.policy_name;
 
     plugin_test_resource->memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
@@ -16,6 +16,9 @@ struct CounterData
   RAJA::Platform launch_platform_active = RAJA::Platform::undefined;
   int            launch_counter_pre     = 0;
   int            launch_counter_post    = 0;
+  size_t         launch_iteration_size  = 0;
+  const char*    launch_kernel_name     = nullptr;
+  const char*    launch_policy_name     = nullptr;
 };
 
 // note the use of a pointer here to allow different types of memory
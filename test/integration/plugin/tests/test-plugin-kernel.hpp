@@ -45,6 +45,11 @@ void PluginKernelTestImpl()
     ASSERT_EQ(loop_data.launch_platform_active, PLATFORM);
     ASSERT_EQ(loop_data.launch_counter_pre,     i+1);
     ASSERT_EQ(loop_data.launch_counter_post,    i);
+    ASSERT_EQ(loop_data.launch_iteration_size,  1u);
+    ASSERT_STREQ(loop_data.launch_kernel_name,
+                 RAJA::detail::type_name<PluginTestCallable>());
+    ASSERT_STREQ(loop_data.launch_policy_name,
+                 RAJA::detail::type_name<KernelPolicy>());
   }
 
   CounterData plugin_data;
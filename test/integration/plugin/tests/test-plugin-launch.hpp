@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing basic integration tests for plugins with launch.
+///
+
+#ifndef __TEST_PLUGIN_LAUNCH_HPP__
+#define __TEST_PLUGIN_LAUNCH_HPP__
+
+#include "test-plugin.hpp"
+
+
+// Check that the plugin is called with the right Platform.
+// Check that the plugin is called the correct number of times,
+// once before and after each kernel capture for the capture counter,
+// once before and after each kernel invocation for the launch counter.
+// Check that the context names the Grid and launch policy and counts the
+// team threads of the Grid.
+
+// test with basic launch
+template <typename LaunchPolicy,
+          typename LoopPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginLaunchTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  for (int i = 0; i < 10; i++) {
+
+    PluginTestCallable callable{data};
+
+    RAJA::expt::launch<LaunchPolicy>(RAJA::expt::HOST,
+      RAJA::expt::Grid(RAJA::expt::Teams(i+1), RAJA::expt::Threads(2),
+                       "plugin-launch"),
+      [=](RAJA::expt::LaunchContext ctx) {
+        RAJA::expt::loop<LoopPolicy>(ctx, RAJA::RangeSegment(i,i+1), callable);
+      }
+    );
+
+    CounterData loop_data;
+    plugin_test_resource->memcpy(&loop_data, &data[i], sizeof(CounterData));
+    ASSERT_EQ(loop_data.capture_platform_active, PLATFORM);
+    ASSERT_EQ(loop_data.capture_counter_pre,     i+1);
+    ASSERT_EQ(loop_data.capture_counter_post,    i);
+    ASSERT_EQ(loop_data.launch_platform_active, PLATFORM);
+    ASSERT_EQ(loop_data.launch_counter_pre,     i+1);
+    ASSERT_EQ(loop_data.launch_counter_post,    i);
+    ASSERT_EQ(loop_data.launch_iteration_size,  size_t(2*(i+1)));
+    ASSERT_STREQ(loop_data.launch_kernel_name,  "plugin-launch");
+    ASSERT_STREQ(loop_data.launch_policy_name,
+                 RAJA::detail::type_name<typename LaunchPolicy::host_policy_t>());
+  }
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.capture_platform_active, RAJA::Platform::undefined);
+  ASSERT_EQ(plugin_data.capture_counter_pre,     10);
+  ASSERT_EQ(plugin_data.capture_counter_post,    10);
+  ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
+  ASSERT_EQ(plugin_data.launch_counter_pre,     10);
+  ASSERT_EQ(plugin_data.launch_counter_post,    10);
+
+  plugin_test_resource->deallocate(data);
+}
+
+
+TYPED_TEST_SUITE_P(PluginLaunchTest);
+template <typename T>
+class PluginLaunchTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(PluginLaunchTest, PluginLaunch)
+{
+  using LaunchPolicy = typename camp::at<typename camp::at<TypeParam, camp::num<0>>::type, camp::num<0>>::type;
+  using LoopPolicy = typename camp::at<typename camp::at<TypeParam, camp::num<0>>::type, camp::num<1>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginLaunchTestImpl<LaunchPolicy, LoopPolicy, ResType, PlatformHolder::platform>( );
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PluginLaunchTest,
+                            PluginLaunch);
+
+#endif  //__TEST_PLUGIN_LAUNCH_HPP__
@@ -41,6 +41,9 @@ struct SetupPluginVars
     data.launch_platform_active = RAJA::Platform::undefined;
     data.launch_counter_pre     = 0;
     data.launch_counter_post    = 0;
+    data.launch_iteration_size  = 0;
+    data.launch_kernel_name     = nullptr;
+    data.launch_policy_name     = nullptr;
 
     m_test_resource.memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
@@ -132,6 +135,9 @@ struct PluginTestCallable
     m_data_optr[i].launch_platform_active = m_data_iptr->launch_platform_active;
     m_data_optr[i].launch_counter_pre     = m_data_iptr->launch_counter_pre;
     m_data_optr[i].launch_counter_post    = m_data_iptr->launch_counter_post;
+    m_data_optr[i].launch_iteration_size  = m_data_iptr->launch_iteration_size;
+    m_data_optr[i].launch_kernel_name     = m_data_iptr->launch_kernel_name;
+    m_data_optr[i].launch_policy_name     = m_data_iptr->launch_policy_name;
   }
 
   RAJA_HOST_DEVICE void operator()(int count, int i) const
@@ -161,6 +167,9 @@ private:
     m_data.launch_platform_active = RAJA::Platform::undefined;
     m_data.launch_counter_pre     = -1;
     m_data.launch_counter_post    = -1;
+    m_data.launch_iteration_size  = 0;
+    m_data.launch_kernel_name     = nullptr;
+    m_data.launch_policy_name     = nullptr;
   }
 };
 
@@ -1114,6 +1114,246 @@ TEST(Kernel, TileTCountTyped)
 }
 
 
+TEST(Kernel, RecursiveTileSeq)
+{
+  using namespace RAJA;
+
+  constexpr int N0 = 37;
+  constexpr int N1 = 53;
+
+  // Transpose, then scale over the untiled segment to check it is restored
+  using Pol = KernelPolicy<
+      statement::RecursiveTile<ArgList<0, 1>,
+                               cache_oblivious_exec<8>,
+                               For<1, seq_exec, For<0, seq_exec, Lambda<0>>>>,
+      For<0, seq_exec, Lambda<1, Segs<0>>>>;
+
+  int *a = new int[N0 * N1];
+  int *at = new int[N0 * N1];
+  int *count = new int[N0 * N1];
+  int *scale = new int[N0];
+
+  for (int i = 0; i < N0 * N1; ++i) {
+    a[i] = i;
+    at[i] = -1;
+    count[i] = 0;
+  }
+  for (int i = 0; i < N0; ++i) {
+    scale[i] = 0;
+  }
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(3, 3 + N0), RangeSegment(0, N1)),
+
+      [=](RAJA::Index_type i, RAJA::Index_type j) {
+        at[(i - 3) * N1 + j] = a[j * N0 + (i - 3)];
+        count[j * N0 + (i - 3)] += 1;
+      },
+      [=](RAJA::Index_type i) { scale[i - 3] += 1; });
+
+  for (int j = 0; j < N1; ++j) {
+    for (int i = 0; i < N0; ++i) {
+      ASSERT_EQ(count[j * N0 + i], 1);
+      ASSERT_EQ(at[i * N1 + j], j * N0 + i);
+    }
+  }
+  for (int i = 0; i < N0; ++i) {
+    ASSERT_EQ(scale[i], 1);
+  }
+
+  delete[] scale;
+  delete[] count;
+  delete[] at;
+  delete[] a;
+}
+
+TEST(Kernel, RecursiveTileSeq3)
+{
+  using namespace RAJA;
+
+  constexpr int N0 = 9;
+  constexpr int N1 = 33;
+  constexpr int N2 = 17;
+
+  using Pol = KernelPolicy<statement::RecursiveTile<
+      ArgList<0, 1, 2>,
+      cache_oblivious_exec<4>,
+      For<2, seq_exec, For<1, seq_exec, For<0, seq_exec, Lambda<0>>>>>>;
+
+  int *count = new int[N0 * N1 * N2];
+  for (int i = 0; i < N0 * N1 * N2; ++i) {
+    count[i] = 0;
+  }
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N0),
+                       RangeSegment(0, N1),
+                       RangeSegment(0, N2)),
+
+      [=](RAJA::Index_type i, RAJA::Index_type j, RAJA::Index_type k) {
+        count[(k * N1 + j) * N0 + i] += 1;
+      });
+
+  for (int i = 0; i < N0 * N1 * N2; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+
+  delete[] count;
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Kernel, RecursiveTileOmp)
+{
+  using namespace RAJA;
+
+  constexpr int N0 = 129;
+  constexpr int N1 = 71;
+
+  using Pol = KernelPolicy<
+      statement::RecursiveTile<ArgList<0, 1>,
+                               omp_cache_oblivious_exec<16, 3>,
+                               For<1, seq_exec, For<0, seq_exec, Lambda<0>>>>>;
+
+  int *count = new int[N0 * N1];
+  for (int i = 0; i < N0 * N1; ++i) {
+    count[i] = 0;
+  }
+
+  ReduceSum<omp_reduce, long> sum(0);
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N0), RangeSegment(0, N1)),
+
+      [=](RAJA::Index_type i, RAJA::Index_type j) {
+        count[j * N0 + i] += 1;
+        sum += j * N0 + i;
+      });
+
+  for (int i = 0; i < N0 * N1; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+  ASSERT_EQ(sum.get(), long(N0 * N1) * (N0 * N1 - 1) / 2);
+
+  delete[] count;
+}
+#endif
+
+TEST(Kernel, FusedForSeq)
+{
+  using namespace RAJA;
+
+  constexpr int N = 37;
+
+  using Pol = KernelPolicy<
+      For<1, seq_exec, statement::FusedFor<0, seq_exec, 0, 1>>>;
+
+  int *x = new int[N * N];
+  int *y = new int[N * N];
+  for (int i = 0; i < N * N; ++i) {
+    x[i] = 0;
+    y[i] = 0;
+  }
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, N)),
+
+      [=](RAJA::Index_type i, RAJA::Index_type j) { x[j * N + i] = i + j; },
+      [=](RAJA::Index_type i, RAJA::Index_type j) {
+        y[j * N + i] = 2 * x[j * N + i];
+      });
+
+  for (int j = 0; j < N; ++j) {
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(x[j * N + i], i + j);
+      ASSERT_EQ(y[j * N + i], 2 * (i + j));
+    }
+  }
+
+  delete[] x;
+  delete[] y;
+}
+
+TEST(Kernel, FusedChunkForSeq)
+{
+  using namespace RAJA;
+
+  constexpr int N = 103;
+  constexpr int C = 16;
+
+  using Pol = KernelPolicy<statement::FusedChunkFor<0, C, seq_exec, 0, 1>>;
+
+  int *a = new int[N];
+  int *b = new int[N];
+  for (int i = 0; i < N; ++i) {
+    a[i] = 0;
+    b[i] = 0;
+  }
+
+  // the second lambda reads the next entry of the chunk written by the first
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N)),
+
+      [=](RAJA::Index_type i) { a[i] = i; },
+      [=](RAJA::Index_type i) {
+        b[i] = ((i + 1) % C == 0 || i + 1 == N) ? -1 : a[i + 1];
+      });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], i);
+    ASSERT_EQ(b[i], ((i + 1) % C == 0 || i + 1 == N) ? -1 : i + 1);
+  }
+
+  delete[] a;
+  delete[] b;
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Kernel, FusedChunkForOmp)
+{
+  using namespace RAJA;
+
+  constexpr int N = 1031;
+  constexpr int C = 64;
+
+  using Pol =
+      KernelPolicy<statement::FusedChunkFor<0, C, omp_parallel_for_exec, 0, 1>>;
+
+  int *a = new int[N];
+  int *b = new int[N];
+  for (int i = 0; i < N; ++i) {
+    a[i] = 0;
+    b[i] = 0;
+  }
+
+  ReduceSum<omp_reduce, long> sum(0);
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N)),
+
+      [=](RAJA::Index_type i) { a[i] = i; },
+      [=](RAJA::Index_type i) {
+        b[i] = ((i + 1) % C == 0 || i + 1 == N) ? -1 : a[i + 1];
+        sum += a[i];
+      });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], i);
+    ASSERT_EQ(b[i], ((i + 1) % C == 0 || i + 1 == N) ? -1 : i + 1);
+  }
+  ASSERT_EQ(sum.get(), long(N) * (N - 1) / 2);
+
+  delete[] a;
+  delete[] b;
+}
+#endif
+
+
 TEST(Kernel, CollapseSeq)
 {
   using namespace RAJA;
@@ -1413,8 +1653,197 @@ TEST(Kernel, Collapse8)
   delete[] data;
 }
 
+
+TEST(Kernel, Collapse9)
+{
+
+  int N = 3;
+  int M = 5;
+  int K = 4;
+  int P = 7;
+
+  int *data = new int[N * M * K * P];
+  for (int i = 0; i < N * M * K * P; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                ArgList<0, 1, 2, 3>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r) {
+        Index_type id = r + P * (i + N * (j + M * k));
+        data[id] += id;
+      });
+
+  for (int k = 0; k < K; ++k) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+        for (int r = 0; r < P; ++r) {
+          Index_type id = r + P * (i + N * (j + M * k));
+          ASSERT_EQ(data[id], id);
+        }
+      }
+    }
+  }
+
+  delete[] data;
+}
+
+
+TEST(Kernel, Collapse10)
+{
+
+  int N = 2;
+  int M = 3;
+  int K = 5;
+  int P = 3;
+  int Q = 7;
+
+  int *data = new int[N * M * K * P * Q];
+  for (int i = 0; i < N * M * K * P * Q; ++i) {
+    data[i] = 0;
+  }
+
+  // collapse loops in an order that differs from the segment tuple
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                ArgList<4, 0, 3, 1, 2>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P),
+                       RAJA::RangeSegment(0, Q)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r, Index_type q) {
+        Index_type id = q + Q * (r + P * (i + N * (j + M * k)));
+        data[id] += 1;
+      });
+
+  for (int i = 0; i < N * M * K * P * Q; ++i) {
+    ASSERT_EQ(data[i], 1);
+  }
+
+  delete[] data;
+}
+
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_TBB)
+
+TEST(Kernel, CollapseTBB2)
+{
+
+  int N = 17;
+  int M = 29;
+
+  int *data = new int[N * M];
+  for (int i = 0; i < N * M; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::tbb_parallel_collapse_affinity_exec<4, 8>,
+                                ArgList<1, 0>,
+                                Lambda<0>>>;
+
+  // run twice, so the second run replays the recorded affinity
+  for (int rep = 0; rep < 2; ++rep) {
+    RAJA::kernel<Pol>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+        [=](Index_type i, Index_type j) { data[i * M + j] += 1; });
+  }
+
+  for (int i = 0; i < N * M; ++i) {
+    ASSERT_EQ(data[i], 2);
+  }
+
+  delete[] data;
+}
+
+
+TEST(Kernel, CollapseTBB3)
+{
+
+  int N = 7;
+  int M = 11;
+  int K = 13;
+
+  int *data = new int[N * M * K];
+  for (int i = 0; i < N * M * K; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::tbb_parallel_collapse_exec<>,
+                                ArgList<0, 1, 2>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N)),
+      [=](Index_type k, Index_type j, Index_type i) {
+        Index_type id = i + N * (j + M * k);
+        data[id] += id;
+      });
+
+  for (int i = 0; i < N * M * K; ++i) {
+    ASSERT_EQ(data[i], i);
+  }
+
+  delete[] data;
+}
+
+
+TEST(Kernel, CollapseTBB4)
+{
+
+  int N = 2;
+  int M = 3;
+  int K = 5;
+  int P = 3;
+  int Q = 7;
+
+  int *data = new int[N * M * K * P * Q];
+  for (int i = 0; i < N * M * K * P * Q; ++i) {
+    data[i] = 0;
+  }
+
+  // collapse loops in an order that differs from the segment tuple
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::tbb_parallel_collapse_exec<1, 2, 1, 1, 4>,
+                                ArgList<4, 0, 3, 1, 2>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P),
+                       RAJA::RangeSegment(0, Q)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r, Index_type q) {
+        Index_type id = q + Q * (r + P * (i + N * (j + M * k)));
+        data[id] += 1;
+      });
+
+  for (int i = 0; i < N * M * K * P * Q; ++i) {
+    ASSERT_EQ(data[i], 1);
+  }
+
+  delete[] data;
+}
+
+#endif  // RAJA_ENABLE_TBB
+
 
 
 
@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for fused forall traversals
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+template <typename ExecPolicy, typename ReducePolicy>
+void testForallFused()
+{
+  constexpr RAJA::Index_type N = 1031;
+
+  std::vector<double> x(N), y(N), z(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    x[i] = static_cast<double>(i);
+    y[i] = 1.0;
+    z[i] = 0.0;
+  }
+  double* px = x.data();
+  double* py = y.data();
+  double* pz = z.data();
+
+  RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+
+  // a daxpy chain, each body reading what the previous one wrote
+  RAJA::forall_fused<ExecPolicy>(
+      RAJA::RangeSegment(0, N),
+      [=](RAJA::Index_type i) { py[i] += 2.0 * px[i]; },
+      [=](RAJA::Index_type i) { pz[i] += 3.0 * py[i]; },
+      [=](RAJA::Index_type i) { sum += pz[i]; });
+
+  double expect = 0.0;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(1.0 + 2.0 * i, y[i]);
+    ASSERT_EQ(3.0 * (1.0 + 2.0 * i), z[i]);
+    expect += z[i];
+  }
+  ASSERT_EQ(expect, sum.get());
+}
+
+template <typename ExecPolicy>
+void testForallFusedChunked()
+{
+  constexpr RAJA::Index_type N = 1031;
+
+  for (RAJA::Index_type chunk : {0, 1, 16, 100, 2000}) {
+    std::vector<int> a(N, 0), b(N, 0);
+    int* pa = a.data();
+    int* pb = b.data();
+
+    // the second body reads a neighbor written by the first, so it needs the
+    // first body to have finished the chunk; skip neighbors in other chunks
+    const RAJA::Index_type c = chunk > 0 ? chunk : N;
+    RAJA::forall_fused_chunked<ExecPolicy>(
+        chunk,
+        RAJA::RangeSegment(0, N),
+        [=](RAJA::Index_type i) { pa[i] = static_cast<int>(i); },
+        [=](RAJA::Index_type i) {
+          const bool last = (i + 1) % c == 0 || i + 1 == N;
+          pb[i] = last ? -1 : pa[i + 1];
+        });
+
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      ASSERT_EQ(i, a[i]);
+      const bool last = (i + 1) % c == 0 || i + 1 == N;
+      ASSERT_EQ(last ? -1 : i + 1, b[i]);
+    }
+  }
+}
+
+TEST(ForallFused, Sequential)
+{
+  testForallFused<RAJA::seq_exec, RAJA::seq_reduce>();
+  testForallFusedChunked<RAJA::seq_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ForallFused, OpenMP)
+{
+  testForallFused<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>();
+  testForallFusedChunked<RAJA::omp_parallel_for_exec>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(ForallFused, TBB)
+{
+  testForallFused<RAJA::tbb_for_exec, RAJA::tbb_reduce>();
+  testForallFusedChunked<RAJA::tbb_for_exec>();
+}
+#endif
@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::pipeline
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+template <typename ExecPolicy, typename ReducePolicy>
+void testPipeline()
+{
+  constexpr RAJA::Index_type N = 10007;
+
+  for (RAJA::Index_type chunk : {1, 64, 1000, 20000}) {
+    std::vector<double> a(N, 0.0), b(N, 0.0), c(N, 0.0);
+    double* pa = a.data();
+    double* pb = b.data();
+    double* pc = c.data();
+
+    RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+    RAJA::ReduceMax<ReducePolicy, double> max(-1.0);
+
+    // the second stage reads the neighbor produced by the first stage, and
+    // both reducers are updated by more than one stage
+    RAJA::pipeline<ExecPolicy>(
+        chunk,
+        RAJA::RangeSegment(0, N),
+        [=](RAJA::Index_type i) {
+          pa[i] = static_cast<double>(i);
+          sum += pa[i];
+        },
+        [=](RAJA::Index_type i) {
+          const bool last = (i + 1) % chunk == 0 || i + 1 == N;
+          pb[i] = last ? pa[i] : pa[i] + pa[i + 1];
+          max.max(pb[i]);
+        },
+        [=](RAJA::Index_type i) {
+          pc[i] = 2.0 * pb[i];
+          sum += pc[i];
+        });
+
+    double expect_sum = 0.0;
+    double expect_max = -1.0;
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      const bool last = (i + 1) % chunk == 0 || i + 1 == N;
+      const double expect_b = last ? i : 2.0 * i + 1.0;
+      ASSERT_EQ(static_cast<double>(i), a[i]);
+      ASSERT_EQ(expect_b, b[i]);
+      ASSERT_EQ(2.0 * expect_b, c[i]);
+      expect_sum += i + 2.0 * expect_b;
+      expect_max = expect_b > expect_max ? expect_b : expect_max;
+    }
+    ASSERT_EQ(expect_sum, sum.get());
+    ASSERT_EQ(expect_max, max.get());
+  }
+}
+
+TEST(Pipeline, Sequential)
+{
+  testPipeline<RAJA::seq_exec, RAJA::seq_reduce>();
+  testPipeline<RAJA::loop_exec, RAJA::seq_reduce>();
+  testPipeline<RAJA::simd_exec, RAJA::seq_reduce>();
+}
+
+TEST(Pipeline, EmptySegment)
+{
+  int calls = 0;
+  RAJA::pipeline<RAJA::seq_exec>(
+      16, RAJA::RangeSegment(0, 0), [&](RAJA::Index_type) { ++calls; });
+  ASSERT_EQ(0, calls);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Pipeline, OpenMP)
+{
+  testPipeline<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>();
+}
+
+TEST(Pipeline, OpenMPRegion)
+{
+  constexpr RAJA::Index_type N = 4099;
+
+  std::vector<int> a(N, 0), b(N, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  RAJA::ReduceSum<RAJA::omp_reduce, long> sum(0);
+
+  RAJA::region<RAJA::omp_parallel_region>([=]() {
+    RAJA::pipeline<RAJA::omp_for_exec>(
+        128,
+        RAJA::RangeSegment(0, N),
+        [=](RAJA::Index_type i) { pa[i] = static_cast<int>(i); },
+        [=](RAJA::Index_type i) {
+          pb[i] = pa[i] + 1;
+          sum += pb[i];
+        });
+  });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(i, a[i]);
+    ASSERT_EQ(i + 1, b[i]);
+  }
+  ASSERT_EQ(long(N) * (N + 1) / 2, sum.get());
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(Pipeline, TBB)
+{
+  testPipeline<RAJA::tbb_for_exec, RAJA::tbb_reduce>();
+  testPipeline<RAJA::tbb_for_dynamic, RAJA::tbb_reduce>();
+}
+#endif
@@ -0,0 +1,148 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for temporal blocking of stencil sweeps
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+//
+// Sweep a 1D stencil of the given radius over the interior of two arrays,
+// with and without temporal blocking, and compare every value
+//
+template <typename ExecPolicy>
+void testTemporalBlock1D(RAJA::Index_type len,
+                         RAJA::Index_type radius,
+                         RAJA::Index_type num_steps,
+                         RAJA::TemporalTiling tiling)
+{
+  const RAJA::Index_type size = len + 2 * radius;
+
+  std::vector<double> a(size), b(size);
+  for (RAJA::Index_type i = 0; i < size; ++i) {
+    a[i] = b[i] = static_cast<double>((i * 7919) % 101);
+  }
+  std::vector<double> ref_a(a), ref_b(b);
+
+  auto stencil = [=](const double* in, double* out, RAJA::Index_type i) {
+    double sum = 0.0;
+    for (RAJA::Index_type d = -radius; d <= radius; ++d) {
+      sum += in[i + d] * (1.0 + 0.125 * d);
+    }
+    out[i] = sum / (2 * radius + 1);
+  };
+
+  for (RAJA::Index_type t = 0; t < num_steps; ++t) {
+    const double* in = t % 2 ? ref_b.data() : ref_a.data();
+    double* out = t % 2 ? ref_a.data() : ref_b.data();
+    for (RAJA::Index_type i = radius; i < len + radius; ++i) {
+      stencil(in, out, i);
+    }
+  }
+
+  double* pa = a.data();
+  double* pb = b.data();
+  RAJA::temporal_block<ExecPolicy>(
+      num_steps,
+      tiling,
+      RAJA::make_tuple(RAJA::RangeSegment(radius, len + radius)),
+      [=](RAJA::Index_type t, RAJA::Index_type i) {
+        stencil(t % 2 ? pb : pa, t % 2 ? pa : pb, i);
+      });
+
+  for (RAJA::Index_type i = 0; i < size; ++i) {
+    ASSERT_EQ(ref_a[i], a[i]);
+    ASSERT_EQ(ref_b[i], b[i]);
+  }
+}
+
+//
+// Jacobi sweeps of a 5-point stencil, tiled along the outer dimension
+//
+template <typename ExecPolicy>
+void testTemporalBlock2D(RAJA::Index_type num_steps,
+                         RAJA::TemporalTiling tiling)
+{
+  constexpr RAJA::Index_type N = 50;
+  constexpr RAJA::Index_type M = 43;
+  constexpr RAJA::Index_type W = M + 2;
+
+  std::vector<double> a((N + 2) * W);
+  for (size_t i = 0; i < a.size(); ++i) {
+    a[i] = static_cast<double>((i * 31) % 17);
+  }
+  std::vector<double> b(a), ref_a(a), ref_b(a);
+
+  auto stencil = [=](const double* in,
+                     double* out,
+                     RAJA::Index_type n,
+                     RAJA::Index_type m) {
+    const RAJA::Index_type id = n * W + m;
+    out[id] = 0.25 * (in[id - W] + in[id + W] + in[id - 1] + in[id + 1]);
+  };
+
+  for (RAJA::Index_type t = 0; t < num_steps; ++t) {
+    const double* in = t % 2 ? ref_b.data() : ref_a.data();
+    double* out = t % 2 ? ref_a.data() : ref_b.data();
+    for (RAJA::Index_type n = 1; n <= N; ++n) {
+      for (RAJA::Index_type m = 1; m <= M; ++m) {
+        stencil(in, out, n, m);
+      }
+    }
+  }
+
+  double* pa = a.data();
+  double* pb = b.data();
+  RAJA::temporal_block<ExecPolicy>(
+      num_steps,
+      tiling,
+      RAJA::make_tuple(RAJA::RangeSegment(1, N + 1), RAJA::RangeSegment(1, M + 1)),
+      [=](RAJA::Index_type t, RAJA::Index_type n, RAJA::Index_type m) {
+        stencil(t % 2 ? pb : pa, t % 2 ? pa : pb, n, m);
+      });
+
+  for (size_t i = 0; i < a.size(); ++i) {
+    ASSERT_EQ(ref_a[i], a[i]);
+    ASSERT_EQ(ref_b[i], b[i]);
+  }
+}
+
+template <typename ExecPolicy>
+void testTemporalBlock()
+{
+  for (RAJA::Index_type len : {1, 5, 37, 200}) {
+    for (RAJA::Index_type radius : {0, 1, 3}) {
+      for (RAJA::Index_type num_steps : {0, 1, 7, 16}) {
+        for (RAJA::Index_type tile_size : {1, 13, 64}) {
+          for (RAJA::Index_type time_block : {1, 3, 8}) {
+            testTemporalBlock1D<ExecPolicy>(
+                len, radius, num_steps, {radius, tile_size, time_block});
+          }
+        }
+      }
+    }
+  }
+
+  testTemporalBlock2D<ExecPolicy>(32, {1, 8, 4});
+  testTemporalBlock2D<ExecPolicy>(9, {1, 20, 16});
+}
+
+TEST(TemporalBlock, Sequential) { testTemporalBlock<RAJA::seq_exec>(); }
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(TemporalBlock, OpenMP)
+{
+  testTemporalBlock<RAJA::omp_parallel_for_exec>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(TemporalBlock, TBB) { testTemporalBlock<RAJA::tbb_for_dynamic>(); }
+#endif
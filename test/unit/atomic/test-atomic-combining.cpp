@@ -0,0 +1,221 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the combining_atomic policy
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <thread>
+#include <type_traits>
+
+using combining_types =
+    ::testing::Types<
+                      std::tuple<int, RAJA::builtin_atomic>,
+                      std::tuple<unsigned int, RAJA::builtin_atomic>,
+                      std::tuple<unsigned long long int, RAJA::builtin_atomic>,
+                      std::tuple<double, RAJA::builtin_atomic>
+#if defined(RAJA_ENABLE_OPENMP)
+                      ,
+                      std::tuple<int, RAJA::omp_atomic>,
+                      std::tuple<unsigned long long int, RAJA::omp_atomic>,
+                      std::tuple<double, RAJA::omp_atomic>
+#endif
+                    >;
+
+template <typename T>
+class AtomicCombiningUnitTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( AtomicCombiningUnitTest );
+
+TYPED_TEST_P( AtomicCombiningUnitTest, CombiningAddMinMax )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy =
+      RAJA::combining_atomic<typename std::tuple_element<1, TypeParam>::type>;
+
+  T sum = (T)0;
+  T lo = (T)50;
+  T hi = (T)50;
+
+  {
+    RAJA::combining_atomic_scope scope;
+    for (int i = 0; i < 100; ++i) {
+      RAJA::atomicAdd<AtomicPolicy>(&sum, (T)2);
+      RAJA::atomicSub<AtomicPolicy>(&sum, (T)1);
+      RAJA::atomicInc<AtomicPolicy>(&sum);
+      RAJA::atomicDec<AtomicPolicy>(&sum);
+      RAJA::atomicMin<AtomicPolicy>(&lo, (T)i);
+      RAJA::atomicMax<AtomicPolicy>(&hi, (T)i);
+    }
+  }
+
+  ASSERT_EQ( sum, (T)100 );
+  ASSERT_EQ( lo, (T)0 );
+  ASSERT_EQ( hi, (T)99 );
+}
+
+TYPED_TEST_P( AtomicCombiningUnitTest, CombiningEviction )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy =
+      RAJA::combining_atomic<typename std::tuple_element<1, TypeParam>::type>;
+
+  // more locations than combining slots, so slots are evicted
+  constexpr int N = 1000;
+  T* bins = new T[N];
+  for (int i = 0; i < N; ++i) {
+    bins[i] = (T)0;
+  }
+
+  for (int r = 0; r < 3; ++r) {
+    for (int i = 0; i < N; ++i) {
+      RAJA::atomicAdd<AtomicPolicy>(&bins[i], (T)1);
+    }
+  }
+  RAJA::flush_combining_atomics();
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ( bins[i], (T)3 );
+  }
+
+  delete[] bins;
+}
+
+TYPED_TEST_P( AtomicCombiningUnitTest, CombiningAtomicRef )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy =
+      RAJA::combining_atomic<typename std::tuple_element<1, TypeParam>::type>;
+
+  T theval = (T)0;
+  RAJA::AtomicRef<T, AtomicPolicy> ref(&theval);
+
+  ref += (T)5;
+  ++ref;
+
+  // loads flush the pending updates of the thread
+  ASSERT_EQ( ref.load(), (T)6 );
+  ASSERT_EQ( theval, (T)6 );
+
+  // stores are not overwritten by earlier pending updates
+  ref += (T)3;
+  ref.store((T)1);
+  RAJA::flush_combining_atomics();
+  ASSERT_EQ( theval, (T)1 );
+
+  // operations that are not combined see all earlier updates of the thread
+  ref += (T)2;
+  ASSERT_EQ( ref.exchange((T)7), (T)3 );
+  ASSERT_EQ( theval, (T)7 );
+}
+
+TYPED_TEST_P( AtomicCombiningUnitTest, CombiningReturnsVoid )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy =
+      RAJA::combining_atomic<typename std::tuple_element<1, TypeParam>::type>;
+
+  T theval = (T)0;
+
+  // deferred updates have no old value to return
+  static_assert(std::is_void<decltype(
+                    RAJA::atomicAdd<AtomicPolicy>(&theval, (T)1))>::value,
+                "combined atomicAdd must return void");
+  static_assert(std::is_void<decltype(
+                    RAJA::atomicMax<AtomicPolicy, RAJA::memory_order_relaxed>(
+                        &theval, (T)1))>::value,
+                "combined atomicMax must return void");
+  static_assert(std::is_void<decltype(
+                    RAJA::atomicInc<AtomicPolicy>(&theval))>::value,
+                "combined atomicInc must return void");
+
+  // operations that are not combined still return the old value
+  RAJA::atomicAdd<AtomicPolicy>(&theval, (T)4);
+  ASSERT_EQ( RAJA::atomicExchange<AtomicPolicy>(&theval, (T)2), (T)4 );
+  ASSERT_EQ( theval, (T)2 );
+}
+
+TYPED_TEST_P( AtomicCombiningUnitTest, CombiningThreadExit )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy =
+      RAJA::combining_atomic<typename std::tuple_element<1, TypeParam>::type>;
+
+  T sum = (T)0;
+  T hi = (T)0;
+
+  // the updates of a thread that exits without flushing are applied when
+  // it exits
+  std::thread worker([&]() {
+    for (int i = 0; i < 100; ++i) {
+      RAJA::atomicAdd<AtomicPolicy>(&sum, (T)1);
+      RAJA::atomicMax<AtomicPolicy>(&hi, (T)i);
+    }
+  });
+  worker.join();
+
+  ASSERT_EQ( sum, (T)100 );
+  ASSERT_EQ( hi, (T)99 );
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TYPED_TEST_P( AtomicCombiningUnitTest, CombiningOpenMP )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy =
+      RAJA::combining_atomic<typename std::tuple_element<1, TypeParam>::type>;
+
+  constexpr int N = 100000;
+  constexpr int B = 8;
+  T bins[B];
+  for (int b = 0; b < B; ++b) {
+    bins[b] = (T)0;
+  }
+  T hi = (T)0;
+
+  {
+    RAJA::combining_atomic_scope scope;
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+      [&](int i) {
+        RAJA::atomicAdd<AtomicPolicy>(&bins[i % B], (T)1);
+        RAJA::atomicMax<AtomicPolicy>(&hi, (T)i);
+      });
+  }
+
+  for (int b = 0; b < B; ++b) {
+    ASSERT_EQ( bins[b], (T)(N / B) );
+  }
+  ASSERT_EQ( hi, (T)(N - 1) );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( AtomicCombiningUnitTest,
+                             CombiningAddMinMax,
+                             CombiningEviction,
+                             CombiningAtomicRef,
+                             CombiningReturnsVoid,
+                             CombiningThreadExit,
+                             CombiningOpenMP
+                           );
+#else
+REGISTER_TYPED_TEST_SUITE_P( AtomicCombiningUnitTest,
+                             CombiningAddMinMax,
+                             CombiningEviction,
+                             CombiningAtomicRef,
+                             CombiningReturnsVoid,
+                             CombiningThreadExit
+                           );
+#endif
+
+INSTANTIATE_TYPED_TEST_SUITE_P( CombiningTest,
+                                AtomicCombiningUnitTest,
+                                combining_types
+                              );
@@ -0,0 +1,174 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for atomics with explicit memory orders
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+using order_types =
+    ::testing::Types<
+                      std::tuple<int, RAJA::builtin_atomic, RAJA::memory_order_relaxed>,
+                      std::tuple<unsigned long long int, RAJA::builtin_atomic, RAJA::memory_order_acquire>,
+                      std::tuple<float, RAJA::builtin_atomic, RAJA::memory_order_release>,
+                      std::tuple<double, RAJA::builtin_atomic, RAJA::memory_order_acq_rel>,
+                      std::tuple<int, RAJA::builtin_atomic, RAJA::memory_order_seq_cst>,
+                      std::tuple<int, RAJA::seq_atomic, RAJA::memory_order_acquire>,
+                      std::tuple<double, RAJA::seq_atomic, RAJA::memory_order_seq_cst>,
+                      std::tuple<int, RAJA::auto_atomic, RAJA::memory_order_relaxed>,
+                      std::tuple<unsigned int, RAJA::auto_atomic, RAJA::memory_order_acq_rel>
+#if defined(RAJA_ENABLE_OPENMP)
+                      ,
+                      std::tuple<int, RAJA::omp_atomic, RAJA::memory_order_relaxed>,
+                      std::tuple<unsigned long long int, RAJA::omp_atomic, RAJA::memory_order_release>,
+                      std::tuple<double, RAJA::omp_atomic, RAJA::memory_order_seq_cst>
+#endif
+                    >;
+
+template <typename T>
+class AtomicMemoryOrderUnitTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( AtomicMemoryOrderUnitTest );
+
+TYPED_TEST_P( AtomicMemoryOrderUnitTest, OrderedAtomicRef )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+  using Order = typename std::tuple_element<2, TypeParam>::type;
+
+  T theval = (T)0;
+  RAJA::AtomicRef<T, AtomicPolicy, Order> test1( &theval );
+
+  test1 += (T)5;
+  test1 -= (T)2;
+  ++test1;
+  test1--;
+  ASSERT_EQ( test1.load(), (T)3 );
+
+  test1.store( (T)10 );
+  ASSERT_EQ( theval, (T)10 );
+
+  ASSERT_EQ( test1.min( (T)4 ), (T)10 );
+  ASSERT_EQ( test1.max( (T)7 ), (T)4 );
+  ASSERT_EQ( test1, (T)7 );
+
+  T expect = (T)7;
+  ASSERT_TRUE( test1.compare_exchange_strong( expect, (T)8 ) );
+  expect = (T)1;
+  ASSERT_FALSE( test1.compare_exchange_strong( expect, (T)9 ) );
+  ASSERT_EQ( expect, (T)8 );
+
+  ASSERT_EQ( test1.exchange( (T)2 ), (T)8 );
+  ASSERT_EQ( theval, (T)2 );
+}
+
+TYPED_TEST_P( AtomicMemoryOrderUnitTest, OrderedFunctions )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+  using Order = typename std::tuple_element<2, TypeParam>::type;
+
+  T theval = (T)0;
+
+  RAJA::atomicStore<AtomicPolicy, Order>( &theval, (T)6 );
+  ASSERT_EQ( (RAJA::atomicLoad<AtomicPolicy, Order>( &theval )), (T)6 );
+
+  ASSERT_EQ( (RAJA::atomicAdd<AtomicPolicy, Order>( &theval, (T)1 )), (T)6 );
+  ASSERT_EQ( (RAJA::atomicSub<AtomicPolicy, Order>( &theval, (T)2 )), (T)7 );
+  ASSERT_EQ( (RAJA::atomicInc<AtomicPolicy, Order>( &theval )), (T)5 );
+  ASSERT_EQ( (RAJA::atomicDec<AtomicPolicy, Order>( &theval )), (T)6 );
+
+  // wrapping increment and decrement
+  ASSERT_EQ( (RAJA::atomicInc<AtomicPolicy, Order>( &theval, (T)5 )), (T)5 );
+  ASSERT_EQ( theval, (T)0 );
+  ASSERT_EQ( (RAJA::atomicDec<AtomicPolicy, Order>( &theval, (T)3 )), (T)0 );
+  ASSERT_EQ( theval, (T)3 );
+
+  ASSERT_EQ( (RAJA::atomicCAS<AtomicPolicy, Order>( &theval, (T)3, (T)4 )), (T)3 );
+  ASSERT_EQ( theval, (T)4 );
+  ASSERT_EQ( (RAJA::atomicExchange<AtomicPolicy, Order>( &theval, (T)1 )), (T)4 );
+  ASSERT_EQ( theval, (T)1 );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( AtomicMemoryOrderUnitTest,
+                             OrderedAtomicRef,
+                             OrderedFunctions
+                           );
+
+INSTANTIATE_TYPED_TEST_SUITE_P( MemoryOrderTest,
+                                AtomicMemoryOrderUnitTest,
+                                order_types
+                              );
+
+template <typename T>
+void testNarrowLoadStore(T first, T second)
+{
+  T theval = first;
+  RAJA::AtomicRef<T, RAJA::builtin_atomic> test1( &theval );
+
+  ASSERT_EQ( test1.load(), first );
+  test1.store( second );
+  ASSERT_EQ( theval, second );
+
+  RAJA::atomicStore<RAJA::builtin_atomic, RAJA::memory_order_release>( &theval, first );
+  ASSERT_EQ( (RAJA::atomicLoad<RAJA::builtin_atomic, RAJA::memory_order_acquire>( &theval )), first );
+}
+
+TEST( AtomicMemoryOrderUnitTest, BuiltinNarrowLoadStore )
+{
+  testNarrowLoadStore<char>( 'a', 'z' );
+  testNarrowLoadStore<bool>( false, true );
+  testNarrowLoadStore<short>( (short)-3, (short)12345 );
+  testNarrowLoadStore<unsigned short>( (unsigned short)7, (unsigned short)65535 );
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST( AtomicMemoryOrderUnitTest, OpenMPReleaseAcquire )
+{
+  // The consumer must see the data written before the release store once
+  // it has seen the flag with an acquire load
+  for (int iter = 0; iter < 100; ++iter) {
+    int data = 0;
+    int flag = 0;
+    int seen = -1;
+
+#pragma omp parallel num_threads(2)
+    {
+#pragma omp single nowait
+      {
+        data = 42;
+        RAJA::atomicStore<RAJA::omp_atomic, RAJA::memory_order_release>(&flag, 1);
+      }
+#pragma omp single nowait
+      {
+        while (RAJA::atomicLoad<RAJA::omp_atomic, RAJA::memory_order_acquire>(&flag) == 0) {
+        }
+        seen = data;
+      }
+    }
+
+    ASSERT_EQ( seen, 42 );
+  }
+}
+
+TEST( AtomicMemoryOrderUnitTest, OpenMPRelaxedCounter )
+{
+  constexpr int N = 100000;
+  unsigned long long count = 0;
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+    [&](int) {
+      RAJA::atomicAdd<RAJA::builtin_atomic, RAJA::memory_order_relaxed>(&count, 1ull);
+    });
+
+  ASSERT_EQ( count, (unsigned long long)N );
+}
+#endif
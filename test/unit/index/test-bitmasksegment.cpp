@@ -0,0 +1,138 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BitmaskSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include "camp/resource.hpp"
+
+#include <cstdint>
+#include <vector>
+
+template<typename T>
+class BitmaskSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(BitmaskSegmentUnitTest, UnitIndexTypes);
+
+//
+// Resource object used to construct segment objects with indices
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+//
+// Bitmap for indices [0, 120), small enough for char indices. The bits of
+// the second word are set only at or beyond 120, so they are not part of
+// the segment and the word is skipped.
+//
+std::vector<uint64_t> makeBits()
+{
+  return std::vector<uint64_t>{uint64_t(0xF0F0F0F0F00F0FF1) | (uint64_t(1) << 63),
+                               ~uint64_t(0) << 56};
+}
+
+template <typename T>
+std::vector<T> bitIndices(const std::vector<uint64_t>& bits, int len)
+{
+  std::vector<T> idx;
+  for (int i = 0; i < len; ++i) {
+    if ((bits[i / 64] >> (i % 64)) & 1) {
+      idx.push_back(static_cast<T>(i));
+    }
+  }
+  return idx;
+}
+
+
+TYPED_TEST(BitmaskSegmentUnitTest, Constructors)
+{
+  std::vector<uint64_t> bits = makeBits();
+
+  RAJA::TypedBitmaskSegment<TypeParam> seg(&bits[0], 0, 120);
+  RAJA::TypedBitmaskSegment<TypeParam> copied(seg);
+
+  ASSERT_EQ(seg, copied);
+  ASSERT_EQ(2, seg.getNumWords());
+
+  RAJA::TypedBitmaskSegment<TypeParam> moved(std::move(copied));
+
+  ASSERT_EQ(seg, moved);
+
+  RAJA::TypedBitmaskSegment<TypeParam> empty(&bits[0], 0, 0);
+
+  ASSERT_EQ(0, empty.size());
+  ASSERT_EQ(empty.begin(), empty.end());
+}
+
+TYPED_TEST(BitmaskSegmentUnitTest, Iterators)
+{
+  std::vector<uint64_t> bits = makeBits();
+  std::vector<TypeParam> idx = bitIndices<TypeParam>(bits, 120);
+  RAJA::TypedBitmaskSegment<TypeParam> seg(&bits[0], 0, 120);
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(idx.size()), seg.size());
+  ASSERT_EQ(seg.size(), seg.end() - seg.begin());
+
+  for (size_t i = 0; i < idx.size(); ++i) {
+    ASSERT_EQ(idx[i], seg.begin()[i]);
+  }
+  ASSERT_EQ(idx.back(), *(seg.end()-1));
+
+  // iterators point at the bitmap and word counts, not at the segment
+  typename RAJA::TypedBitmaskSegment<TypeParam>::iterator first, last;
+  {
+    RAJA::TypedBitmaskSegment<TypeParam> copied(seg);
+    first = copied.begin();
+    last = copied.end();
+  }
+
+  ASSERT_EQ(idx, std::vector<TypeParam>(first, last));
+}
+
+TYPED_TEST(BitmaskSegmentUnitTest, Words)
+{
+  std::vector<uint64_t> bits = makeBits();
+  std::vector<TypeParam> idx = bitIndices<TypeParam>(bits, 120);
+  RAJA::TypedBitmaskSegment<TypeParam> seg(&bits[0], 0, 120);
+
+  std::vector<TypeParam> visited;
+  seg.visitWords(0, 1, [&](TypeParam i) { visited.push_back(i); });
+
+  ASSERT_EQ(idx, visited);
+
+  seg.visitWords(1, seg.getNumWords(), [&](TypeParam i) { visited.push_back(i); });
+
+  ASSERT_EQ(idx, visited);
+}
+
+TYPED_TEST(BitmaskSegmentUnitTest, ListConversion)
+{
+  std::vector<uint64_t> bits = makeBits();
+  std::vector<TypeParam> idx = bitIndices<TypeParam>(bits, 120);
+  RAJA::TypedBitmaskSegment<TypeParam> seg(&bits[0], 0, 120);
+
+  RAJA::TypedListSegment<TypeParam> list = seg.toListSegment(host_res);
+
+  ASSERT_TRUE(list.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedBitmaskSegment<TypeParam> from_list(list);
+
+  ASSERT_EQ(seg, from_list);
+
+  // unsorted indices with duplicates are visited once each, in order
+  std::vector<TypeParam> unsorted{9, 3, 3, 100, 4};
+  std::vector<TypeParam> sorted{3, 4, 9, 100};
+  RAJA::TypedBitmaskSegment<TypeParam> dedup(
+      RAJA::TypedListSegment<TypeParam>(unsorted, host_res));
+
+  ASSERT_EQ(sorted, std::vector<TypeParam>(dedup.begin(), dedup.end()));
+}
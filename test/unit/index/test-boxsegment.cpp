@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BoxSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+template<typename T>
+class BoxSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(BoxSegmentUnitTest, UnitIndexTypes);
+
+//
+// Visit the points of a box and check each point is visited once
+//
+template <typename BoxType>
+std::vector<typename BoxType::value_type> visitAll(const BoxType& box)
+{
+  std::vector<typename BoxType::value_type> points;
+  box.visit([&](typename BoxType::value_type p) { points.push_back(p); });
+
+  std::vector<typename BoxType::value_type> row_major(box.begin(), box.end());
+  EXPECT_EQ(row_major.size(), points.size());
+  for (auto& p : row_major) {
+    EXPECT_EQ(1, std::count(points.begin(), points.end(), p));
+  }
+  return points;
+}
+
+
+TYPED_TEST(BoxSegmentUnitTest, Constructors)
+{
+  RAJA::TypedBoxSegment<TypeParam, 3> box({{1, 2, 3}}, {{4, 6, 5}});
+  RAJA::TypedBoxSegment<TypeParam, 3> copied(box);
+
+  ASSERT_EQ(box, copied);
+  ASSERT_EQ(24, box.size());
+  ASSERT_EQ(2, box.getLower(1));
+  ASSERT_EQ(6, box.getUpper(1));
+
+  RAJA::TypedBoxSegment<TypeParam, 3> empty({{1, 2, 3}}, {{4, 2, 5}});
+
+  ASSERT_EQ(0, empty.size());
+  ASSERT_EQ(empty.begin(), empty.end());
+}
+
+TYPED_TEST(BoxSegmentUnitTest, Iterators)
+{
+  RAJA::TypedBoxSegment<TypeParam, 2> box({{1, 2}}, {{4, 6}});
+
+  ASSERT_EQ(box.size(), box.end() - box.begin());
+
+  auto it = box.begin();
+  for (TypeParam i = 1; i < 4; ++i) {
+    for (TypeParam j = 2; j < 6; ++j) {
+      ASSERT_EQ(i, (*it)[0]);
+      ASSERT_EQ(j, (*it)[1]);
+      ++it;
+    }
+  }
+  ASSERT_EQ(box.end(), it);
+}
+
+TYPED_TEST(BoxSegmentUnitTest, Orders)
+{
+  std::array<TypeParam, 3> lower{{1, 0, 2}};
+  std::array<TypeParam, 3> upper{{6, 7, 5}};
+
+  RAJA::TypedBoxSegment<TypeParam, 3> box(lower, upper);
+  std::vector<RAJA::BoxIndex<TypeParam, 3>> row_major(box.begin(), box.end());
+  ASSERT_EQ(row_major, visitAll(box));
+
+  visitAll(RAJA::TypedBoxSegment<TypeParam, 3, RAJA::box_order::tiled<2>>(
+      lower, upper));
+  visitAll(RAJA::TypedBoxSegment<TypeParam, 3, RAJA::box_order::morton>(
+      lower, upper));
+
+  // consecutive points of a Hilbert curve are neighbors
+  auto hilbert = visitAll(
+      RAJA::TypedBoxSegment<TypeParam, 3, RAJA::box_order::hilbert>(
+          {{0, 0, 0}}, {{8, 8, 8}}));
+  for (size_t i = 1; i < hilbert.size(); ++i) {
+    int dist = 0;
+    for (size_t d = 0; d < 3; ++d) {
+      dist += std::abs(static_cast<int>(hilbert[i][d]) -
+                       static_cast<int>(hilbert[i - 1][d]));
+    }
+    ASSERT_EQ(1, dist);
+  }
+}
+
+TYPED_TEST(BoxSegmentUnitTest, SubBoxes)
+{
+  RAJA::TypedBoxSegment<TypeParam, 3> box({{1, 0, 2}}, {{6, 7, 5}});
+
+  std::vector<RAJA::BoxIndex<TypeParam, 3>> points;
+  for (RAJA::Index_type piece = 0; piece < 32; ++piece) {
+    auto sub = box.getSubBox(piece, 5);
+    points.insert(points.end(), sub.begin(), sub.end());
+  }
+
+  ASSERT_EQ(box.size(), static_cast<RAJA::Index_type>(points.size()));
+  for (auto it = box.begin(); it != box.end(); ++it) {
+    ASSERT_EQ(1, std::count(points.begin(), points.end(), *it));
+  }
+}
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for CompressedListSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+template<typename T>
+class CompressedListSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(CompressedListSegmentUnitTest, UnitIndexTypes);
+
+//
+// Resource object used to construct segment objects with indices
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+//
+// Indices spanning several blocks, mostly increasing with a few jumps back
+//
+template <typename T>
+std::vector<T> makeIndices()
+{
+  std::vector<T> idx;
+  for (int i = 0; i < 300; ++i) {
+    idx.push_back(static_cast<T>((i % 50 == 49) ? i / 3 : i / 4 + i % 3));
+  }
+  return idx;
+}
+
+
+TYPED_TEST(CompressedListSegmentUnitTest, Constructors)
+{
+  std::vector<TypeParam> idx = makeIndices<TypeParam>();
+
+  RAJA::TypedCompressedListSegment<TypeParam> seg(&idx[0], idx.size(), host_res);
+  RAJA::TypedCompressedListSegment<TypeParam> copied(seg);
+
+  ASSERT_EQ(seg, copied);
+  ASSERT_TRUE(copied.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedCompressedListSegment<TypeParam> container(idx, host_res);
+
+  ASSERT_EQ(seg, container);
+
+  RAJA::TypedCompressedListSegment<TypeParam> empty(&idx[0], 0, host_res);
+
+  ASSERT_EQ(0, empty.size());
+  ASSERT_EQ(empty.begin(), empty.end());
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Iterators)
+{
+  std::vector<TypeParam> idx = makeIndices<TypeParam>();
+  RAJA::TypedCompressedListSegment<TypeParam> seg(idx, host_res);
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(idx.size()), seg.size());
+  ASSERT_EQ(seg.size(), seg.end() - seg.begin());
+
+  for (size_t i = 0; i < idx.size(); ++i) {
+    ASSERT_EQ(idx[i], seg.begin()[i]);
+  }
+  ASSERT_EQ(idx.back(), *(seg.end()-1));
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Blocks)
+{
+  std::vector<TypeParam> idx = makeIndices<TypeParam>();
+  RAJA::TypedCompressedListSegment<TypeParam> seg(idx, host_res);
+
+  using SegType = RAJA::TypedCompressedListSegment<TypeParam>;
+  ASSERT_EQ(3, seg.getNumBlocks());
+
+  TypeParam block[SegType::block_size];
+  size_t count = 0;
+  for (RAJA::Index_type b = 0; b < seg.getNumBlocks(); ++b) {
+    RAJA::Index_type len = seg.decodeBlock(b, block);
+    for (RAJA::Index_type i = 0; i < len; ++i) {
+      ASSERT_EQ(idx[count++], block[i]);
+    }
+  }
+  ASSERT_EQ(idx.size(), count);
+}
+
+TEST(CompressedListSegmentUnitTest, Compression)
+{
+  std::vector<RAJA::Index_type> idx = makeIndices<RAJA::Index_type>();
+  RAJA::CompressedListSegment seg(idx, host_res);
+
+  ASSERT_LT(4 * seg.getCompressedBytes(), idx.size() * sizeof(RAJA::Index_type));
+}
+
+TEST(CompressedListSegmentUnitTest, Extremes)
+{
+  std::vector<RAJA::Index_type> idx{
+      std::numeric_limits<RAJA::Index_type>::max(), 0, -1, 7,
+      std::numeric_limits<RAJA::Index_type>::min()};
+  RAJA::CompressedListSegment seg(idx, host_res);
+
+  ASSERT_TRUE(seg.indicesEqual(&idx[0], idx.size()));
+}
@@ -107,6 +107,34 @@ TEST(IndexSetUnitTest, Swap)
   ASSERT_EQ(size_t(0), iset1.getLength());
 }
 
+TEST(IndexSetUnitTest, SegmentLengths)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using ListSegType = RAJA::TypedListSegment<int>;
+  using RLIndexSetType = RAJA::TypedIndexSet<RangeSegType, ListSegType>;
+
+  int idx[] = {7, 3, 5};
+
+  RLIndexSetType iset;
+  iset.push_back(RangeSegType(0, 10));
+  iset.push_back(ListSegType(idx, 3, host_res));
+  iset.push_back(RangeSegType(20, 20));
+  iset.push_front(RangeSegType(0, 4));
+
+  ASSERT_EQ(size_t(17), iset.getLength());
+
+  ASSERT_EQ(4, iset.getSegmentLength(0));
+  ASSERT_EQ(10, iset.getSegmentLength(1));
+  ASSERT_EQ(3, iset.getSegmentLength(2));
+  ASSERT_EQ(0, iset.getSegmentLength(3));
+
+  ASSERT_EQ(size_t(0), iset.getSegmentAtIcount(0));
+  ASSERT_EQ(size_t(1), iset.getSegmentAtIcount(4));
+  ASSERT_EQ(size_t(2), iset.getSegmentAtIcount(5));
+  ASSERT_EQ(size_t(3), iset.getSegmentAtIcount(17));
+  ASSERT_EQ(size_t(4), iset.getSegmentAtIcount(18));
+}
+
 TEST(IndexSetUnitTest, Slice)
 {
   using RangeSegType = RAJA::TypedRangeSegment<int>;
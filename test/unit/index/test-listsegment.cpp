@@ -100,3 +100,36 @@ TYPED_TEST(ListSegmentUnitTest, Iterators)
   ASSERT_EQ(4, list.size());
 }
 
+
+TYPED_TEST(ListSegmentUnitTest, SpanViews)
+{
+  std::vector<TypeParam> idx{5,3,1,2};
+
+  RAJA::TypedListSegment<TypeParam> view(
+      RAJA::make_span(idx.data(), idx.size()));
+
+  ASSERT_EQ(idx.data(), view.begin());
+  ASSERT_EQ(4, view.size());
+  ASSERT_EQ(RAJA::Unowned, view.getIndexOwnership());
+
+  RAJA::TypedListSegment<TypeParam> copied(view);
+
+  ASSERT_EQ(idx.data(), copied.begin());
+  ASSERT_EQ(RAJA::Unowned, copied.getIndexOwnership());
+}
+
+TYPED_TEST(ListSegmentUnitTest, SharedCopies)
+{
+  std::vector<TypeParam> idx{5,3,1,2};
+
+  RAJA::TypedListSegment<TypeParam>* list =
+      new RAJA::TypedListSegment<TypeParam>( idx, host_res );
+  RAJA::TypedListSegment<TypeParam> copied(*list);
+
+  ASSERT_EQ(list->begin(), copied.begin());
+  ASSERT_EQ(RAJA::Owned, copied.getIndexOwnership());
+
+  delete list;
+
+  ASSERT_TRUE(copied.indicesEqual( idx.data(), idx.size() ));
+}
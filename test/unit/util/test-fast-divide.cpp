@@ -0,0 +1,73 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for FastDivisor
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+template <typename T>
+void checkFastDivisor(T d, T n)
+{
+  const RAJA::detail::FastDivisor<T> div(d);
+  ASSERT_EQ(n / d, div.divide(n));
+  ASSERT_EQ(n % d, div.modulo(n));
+}
+
+template <typename T>
+void testFastDivisorTypes()
+{
+  const T max_n = static_cast<T>(
+      (uint64_t(1) << RAJA::detail::FastDivisor<T>::dividend_bits) - 1);
+
+  std::vector<T> divisors{1, 2, 3, 5, 7, 64, 641, 1000, max_n / 2, max_n - 1,
+                          max_n};
+  for (int b = 1; b < RAJA::detail::FastDivisor<T>::dividend_bits; ++b) {
+    const T p = static_cast<T>(uint64_t(1) << b);
+    divisors.push_back(p - 1);
+    divisors.push_back(p);
+    divisors.push_back(p + 1);
+  }
+
+  std::mt19937_64 gen(1234);
+  std::uniform_int_distribution<uint64_t> dist(0, static_cast<uint64_t>(max_n));
+
+  for (T d : divisors) {
+    for (T n : {T(0), T(1), d - 1, d, max_n - 1, max_n}) {
+      checkFastDivisor(d, n);
+    }
+    for (int r = 0; r < 100; ++r) {
+      checkFastDivisor(d, static_cast<T>(dist(gen)));
+      checkFastDivisor(d, static_cast<T>(dist(gen) >> (r % 32)));
+    }
+  }
+}
+
+TEST(FastDivideUnitTest, DivideAndModulo)
+{
+  testFastDivisorTypes<unsigned short>();
+  testFastDivisorTypes<int>();
+  testFastDivisorTypes<unsigned int>();
+  testFastDivisorTypes<long long>();
+  testFastDivisorTypes<size_t>();
+}
+
+TEST(FastDivideUnitTest, Divisor)
+{
+  const RAJA::detail::FastDivisor<int> div(7);
+  ASSERT_EQ(7, static_cast<int>(div));
+
+  // zero divisors, as in a default-constructed layout, divide by one
+  const RAJA::detail::FastDivisor<long> zero(0);
+  ASSERT_EQ(1, static_cast<long>(zero));
+  ASSERT_EQ(42, zero.divide(42));
+}
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for NUMA-aware allocation
+///
+
+#include "RAJA_test-base.hpp"
+
+static constexpr size_t NUMA_TEST_LEN = 1000003;
+
+void testPlacement(RAJA::numa::placement mode)
+{
+  double* a = RAJA::numa::allocate<double>(NUMA_TEST_LEN, mode);
+  ASSERT_NE(nullptr, a);
+
+  for (size_t i = 0; i < NUMA_TEST_LEN; ++i) {
+    ASSERT_EQ(0.0, a[i]);
+  }
+
+  RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, NUMA_TEST_LEN),
+                                [=](RAJA::Index_type i) { a[i] = i; });
+  ASSERT_EQ(NUMA_TEST_LEN - 1.0, a[NUMA_TEST_LEN - 1]);
+
+  // pages bound to node 0 are there, where the system reports placement
+  int node = RAJA::numa::getNode(a);
+  if (mode == RAJA::numa::placement::bind && node >= 0) {
+    ASSERT_EQ(0, node);
+  }
+
+  RAJA::numa::deallocate(a);
+}
+
+TEST(NumaAllocator, Placement)
+{
+  ASSERT_GE(RAJA::numa::getNumNodes(), 1);
+
+  testPlacement(RAJA::numa::placement::first_touch);
+  testPlacement(RAJA::numa::placement::interleave);
+  testPlacement(RAJA::numa::placement::bind);
+
+  ASSERT_EQ(nullptr, RAJA::numa::allocate(0));
+}
+
+TEST(NumaAllocator, BindInvalidNode)
+{
+#if defined(__linux__)
+  ASSERT_THROW(RAJA::numa::allocate<double>(NUMA_TEST_LEN,
+                                            RAJA::numa::placement::bind,
+                                            -1),
+               std::runtime_error);
+  ASSERT_THROW(RAJA::numa::allocate<double>(NUMA_TEST_LEN,
+                                            RAJA::numa::placement::bind,
+                                            1 << 20),
+               std::runtime_error);
+#endif
+
+  // the node is ignored by the other modes
+  double* a = RAJA::numa::allocate<double>(NUMA_TEST_LEN,
+                                           RAJA::numa::placement::interleave,
+                                           -1);
+  ASSERT_NE(nullptr, a);
+  RAJA::numa::deallocate(a);
+}
+
+TEST(NumaAllocator, MovePages)
+{
+  const size_t nbytes = NUMA_TEST_LEN * sizeof(double);
+  double* a = RAJA::numa::allocate<double>(NUMA_TEST_LEN);
+  a[0] = 1.0;
+
+  long moved = RAJA::numa::movePages(a, nbytes, 0);
+  if (moved >= 0) {
+    // all pages were touched at allocation
+    ASSERT_GT(moved, 0);
+    ASSERT_EQ(0, RAJA::numa::getNode(a));
+  }
+  ASSERT_EQ(1.0, a[0]);
+
+  RAJA::numa::deallocate(a);
+}
+
+TEST(NumaAllocator, MemPool)
+{
+  using pool_type =
+      RAJA::basic_mempool::MemPool<RAJA::numa::interleave_allocator>;
+
+  double* a = pool_type::getInstance().malloc<double>(1000);
+  ASSERT_NE(nullptr, a);
+  a[999] = 1.0;
+  pool_type::getInstance().free(a);
+}
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for space-filling curve renumbering
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+//
+// Points of an 8 x 8 grid, numbered in a scrambled order
+//
+struct GridPoints {
+  std::vector<double> x, y;
+
+  GridPoints()
+  {
+    for (int n = 0; n < 64; ++n) {
+      int cell = (n * 37) % 64;
+      x.push_back(cell % 8);
+      y.push_back(cell / 8);
+    }
+  }
+};
+
+template <typename ExecPolicy, typename Order>
+std::vector<RAJA::Index_type> curvePermutation(const GridPoints& grid)
+{
+  std::vector<RAJA::Index_type> perm(grid.x.size());
+  RAJA::computeCurvePermutation<ExecPolicy, Order>(
+      std::array<const double*, 2>{{grid.x.data(), grid.y.data()}},
+      perm.size(),
+      perm.data());
+
+  std::vector<RAJA::Index_type> sorted(perm);
+  std::sort(sorted.begin(), sorted.end());
+  for (size_t i = 0; i < sorted.size(); ++i) {
+    EXPECT_EQ(static_cast<RAJA::Index_type>(i), sorted[i]);
+  }
+  return perm;
+}
+
+template <typename ExecPolicy>
+void testCurvePermutation()
+{
+  GridPoints grid;
+
+  // consecutive points of a Hilbert curve are neighbors
+  auto perm = curvePermutation<ExecPolicy, RAJA::box_order::hilbert>(grid);
+  for (size_t i = 1; i < perm.size(); ++i) {
+    double dist = std::abs(grid.x[perm[i]] - grid.x[perm[i - 1]]) +
+                  std::abs(grid.y[perm[i]] - grid.y[perm[i - 1]]);
+    ASSERT_EQ(1.0, dist);
+  }
+
+  // each aligned 2 x 2 block is visited together by a Morton curve
+  perm = curvePermutation<ExecPolicy, RAJA::box_order::morton>(grid);
+  for (size_t i = 0; i < perm.size(); i += 4) {
+    for (size_t j = i + 1; j < i + 4; ++j) {
+      ASSERT_EQ(static_cast<int>(grid.x[perm[i]]) / 2,
+                static_cast<int>(grid.x[perm[j]]) / 2);
+      ASSERT_EQ(static_cast<int>(grid.y[perm[i]]) / 2,
+                static_cast<int>(grid.y[perm[j]]) / 2);
+    }
+  }
+}
+
+TEST(SpaceFillingCurve, CurvePermutation)
+{
+  testCurvePermutation<RAJA::seq_exec>();
+#if defined(RAJA_ENABLE_OPENMP)
+  testCurvePermutation<RAJA::omp_parallel_for_exec>();
+#endif
+}
+
+TEST(SpaceFillingCurve, Renumber)
+{
+  GridPoints grid;
+  const RAJA::Index_type len = grid.x.size();
+
+  auto perm = curvePermutation<RAJA::seq_exec, RAJA::box_order::hilbert>(grid);
+  std::vector<RAJA::Index_type> inv(len);
+  RAJA::invertPermutation<RAJA::seq_exec>(perm.data(), len, inv.data());
+
+  std::vector<double> new_x(len);
+  RAJA::permuteArray<RAJA::seq_exec>(perm.data(), len, grid.x.data(),
+                                     new_x.data());
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    ASSERT_EQ(grid.x[i], new_x[inv[i]]);
+  }
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  std::vector<RAJA::Index_type> idx{5, 40, 17, 3};
+  RAJA::ListSegment seg(idx, host_res);
+  RAJA::ListSegment renumbered = RAJA::renumberSegment(seg, inv.data(), host_res);
+
+  ASSERT_EQ(seg.size(), renumbered.size());
+  ASSERT_TRUE(std::is_sorted(renumbered.begin(), renumbered.end()));
+  for (auto i : idx) {
+    ASSERT_EQ(1, std::count(renumbered.begin(), renumbered.end(), inv[i]));
+  }
+
+  // the old numbers of new points 10-19 become a range segment
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+  iset.push_back(seg);
+  iset.push_back(RAJA::ListSegment(&perm[10], 10, host_res));
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> new_iset;
+  RAJA::renumberIndexSet(new_iset, host_res, iset, inv.data());
+
+  ASSERT_EQ(2u, new_iset.getNumSegments());
+  ASSERT_EQ(renumbered, new_iset.getSegment<const RAJA::ListSegment>(0));
+  ASSERT_EQ(RAJA::RangeSegment(10, 20),
+            new_iset.getSegment<const RAJA::RangeSegment>(1));
+}
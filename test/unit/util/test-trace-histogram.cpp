@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the TraceHistogram class
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/TracePlugin.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using RAJA::util::TraceHistogram;
+
+namespace
+{
+
+std::vector<uint64_t> edgeValues()
+{
+  std::vector<uint64_t> values{0, 1, 15, 16, 17, 31, 32, 33, 1000, 1000000};
+  for (int bit = 5; bit < 64; ++bit) {
+    const uint64_t p = uint64_t(1) << bit;
+    values.push_back(p - 1);
+    values.push_back(p);
+    values.push_back(p + 1);
+  }
+  values.push_back(~uint64_t(0));
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+}  // namespace
+
+TEST(TraceHistogramUnitTest, SmallValuesHaveOwnBuckets)
+{
+  for (uint64_t v = 0; v < 2 * TraceHistogram::sub_bucket_count; ++v) {
+    ASSERT_EQ(v, TraceHistogram::bucketIndex(v));
+    ASSERT_EQ(v, TraceHistogram::bucketLowerBound(v));
+  }
+}
+
+TEST(TraceHistogramUnitTest, BucketIndexEdges)
+{
+  const size_t bucket_count = TraceHistogram::bucket_count;
+  ASSERT_EQ(bucket_count - 1, TraceHistogram::bucketIndex(~uint64_t(0)));
+
+  size_t last = 0;
+  for (uint64_t v : edgeValues()) {
+    const size_t index = TraceHistogram::bucketIndex(v);
+    ASSERT_LT(index, bucket_count);
+    ASSERT_LE(last, index);
+    last = index;
+
+    // the bucket holds v, and is at most 1/16 of its lower bound wide
+    const uint64_t lower = TraceHistogram::bucketLowerBound(index);
+    ASSERT_LE(lower, v);
+    if (index + 1 < bucket_count) {
+      const uint64_t upper = TraceHistogram::bucketLowerBound(index + 1);
+      ASSERT_LT(v, upper);
+      ASSERT_LE(upper - lower,
+                std::max<uint64_t>(1, lower / TraceHistogram::sub_bucket_count));
+    }
+  }
+
+  for (int bit = 0; bit < 64; ++bit) {
+    const uint64_t p = uint64_t(1) << bit;
+    ASSERT_EQ(p, TraceHistogram::bucketLowerBound(TraceHistogram::bucketIndex(p)));
+  }
+}
+
+TEST(TraceHistogramUnitTest, Empty)
+{
+  TraceHistogram h;
+
+  ASSERT_EQ(0u, h.count());
+  ASSERT_EQ(0u, h.min());
+  ASSERT_EQ(0u, h.max());
+  ASSERT_EQ(0.0, h.mean());
+  ASSERT_EQ(0u, h.percentile(0.5));
+}
+
+TEST(TraceHistogramUnitTest, Percentile)
+{
+  TraceHistogram h;
+  for (uint64_t v = 1; v <= 1000; ++v) {
+    h.record(v);
+  }
+
+  ASSERT_EQ(1000u, h.count());
+  ASSERT_EQ(1u, h.min());
+  ASSERT_EQ(1000u, h.max());
+  ASSERT_EQ(500500u, h.sum());
+  ASSERT_DOUBLE_EQ(500.5, h.mean());
+
+  // percentiles report the highest value of the bucket they fall in
+  ASSERT_EQ(1u, h.percentile(0.0));
+  ASSERT_EQ(1000u, h.percentile(1.0));
+  for (double f : {0.1, 0.5, 0.9, 0.99}) {
+    const uint64_t exact = static_cast<uint64_t>(f * 1000 + 0.5);
+    const uint64_t p = h.percentile(f);
+    ASSERT_LE(exact, p);
+    ASSERT_LE(p, exact + exact / TraceHistogram::sub_bucket_count);
+  }
+}
+
+TEST(TraceHistogramUnitTest, PercentileClampedToMax)
+{
+  TraceHistogram h;
+  h.record(1000);
+  ASSERT_EQ(1000u, h.percentile(0.5));
+
+  // without the clamp to the maximum, the highest value of the bucket
+  h.record(~uint64_t(0));
+  const size_t index = TraceHistogram::bucketIndex(1000);
+  ASSERT_EQ(TraceHistogram::bucketLowerBound(index + 1) - 1, h.percentile(0.5));
+  ASSERT_EQ(~uint64_t(0), h.percentile(1.0));
+}
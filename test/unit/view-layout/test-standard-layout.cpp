@@ -175,3 +175,78 @@ TEST(LayoutUnitTest, 2D_IJ_ProjJ)
   }
 }
 
+
+TEST(OffsetLayoutUnitTest, 2D_toIndices)
+{
+  /*
+   * Construct a 2D offset layout with indices [-2, 3] x [10, 16]
+   */
+  const auto layout =
+      RAJA::make_offset_layout<2>({{-2, 10}}, {{3, 16}});
+
+  // Check that we get the identity
+  for (int k = 0; k < 42; ++k) {
+
+    // inverse map
+    int i, j;
+    layout.toIndices(k, i, j);
+
+    ASSERT_TRUE(-2 <= i && i <= 3);
+    ASSERT_TRUE(10 <= j && j <= 16);
+
+    // forward map
+    ASSERT_EQ(k, layout(i, j));
+  }
+}
+
+TEST(LayoutUnitTest, 4D_Permuted_toIndices)
+{
+  /*
+   * Construct a 4D layout with odd sizes, so that no divisor of the
+   * inverse map is a power of two
+   */
+  const auto layout = RAJA::make_permuted_layout(
+      {{3, 7, 11, 5}}, RAJA::as_array<RAJA::Perm<2, 0, 3, 1>>::get());
+
+  // Check that we get the identity
+  for (int k = 0; k < 3 * 7 * 11 * 5; ++k) {
+
+    // inverse map
+    int i, j, l, m;
+    layout.toIndices(k, i, j, l, m);
+
+    ASSERT_TRUE(0 <= i && i < 3);
+    ASSERT_TRUE(0 <= j && j < 7);
+    ASSERT_TRUE(0 <= l && l < 11);
+    ASSERT_TRUE(0 <= m && m < 5);
+
+    // forward map
+    ASSERT_EQ(k, layout(i, j, l, m));
+  }
+}
+
+TEST(LayoutUnitTest, 2D_Unsigned_toIndices_Above2To31)
+{
+  /*
+   * Construct a layout with unsigned 32-bit linear indices and more than
+   * 2^31 entries, with a divisor that is not a power of two
+   */
+  const RAJA::Layout<2, unsigned int> layout(65537u, 40001u);
+
+  const unsigned int size = layout.size();
+  ASSERT_GT(size, 2147483648u);
+
+  for (unsigned int k : {0u, 40000u, 2147483647u, 2147483648u,
+                         3000000001u, size - 40001u, size - 1u}) {
+
+    // inverse map
+    unsigned int i, j;
+    layout.toIndices(k, i, j);
+
+    ASSERT_EQ(k / 40001u, i);
+    ASSERT_EQ(k % 40001u, j);
+
+    // forward map
+    ASSERT_EQ(k, layout(i, j));
+  }
+}